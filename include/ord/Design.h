@@ -138,7 +138,7 @@ class Design
   void link(const std::string& design_name);
 
   void readDb(const std::string& file_name);
-  void writeDb(const std::string& file_name);
+  void writeDb(const std::string& file_name, bool compress = false);
   void writeDef(const std::string& file_name);
 
   odb::dbBlock* getBlock();
@@ -230,7 +230,7 @@ class OpenRoad
   void designCreated();
 
   void readDb(const char* filename);
-  void writeDb(const char* filename);
+  void writeDb(const char* filename, bool compress = false);
 
   void diffDbs(const char* filename1, const char* filename2, const char* diffs);
 
@@ -104,10 +104,10 @@ void Design::readDb(const std::string& file_name)
   app->readDb(file_name.c_str());
 }
 
-void Design::writeDb(const std::string& file_name)
+void Design::writeDb(const std::string& file_name, bool compress)
 {
   auto app = OpenRoad::openRoad();
-  app->writeDb(file_name.c_str());
+  app->writeDb(file_name.c_str(), compress);
 }
 
 void Design::writeDef(const std::string& file_name)
@@ -321,6 +321,7 @@ void OpenRoad::readDef(const char* filename,
   if (continue_on_errors) {
     def_reader.continueOnErrors();
   }
+  def_reader.setThreads(threads_);
   dbBlock* block = nullptr;
   if (child) {
     auto parent = db_->getChip()->getBlock();
@@ -422,23 +423,18 @@ void OpenRoad::readDb(const char* filename)
         ORD, 47, "You can't load a new db file as the db is already populated");
   }
 
-  std::ifstream stream;
-  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                    | std::ios::eofbit);
-  stream.open(filename, std::ios::binary);
-
-  db_->read(stream);
+  db_->read(filename);
 
   for (OpenRoadObserver* observer : observers_) {
     observer->postReadDb(db_);
   }
 }
 
-void OpenRoad::writeDb(const char* filename)
+void OpenRoad::writeDb(const char* filename, bool compress)
 {
   FILE* stream = fopen(filename, "w");
   if (stream) {
-    db_->write(stream);
+    db_->write(stream, compress);
     fclose(stream);
   }
 }
@@ -177,12 +177,14 @@ proc read_db { args } {
   ord::read_db_cmd $filename
 }
 
-sta::define_cmd_args "write_db" {filename}
+sta::define_cmd_args "write_db" {[-compress] filename}
 
 proc write_db { args } {
+  sta::parse_key_args "write_db" args keys {} flags {-compress}
   sta::check_argc_eq1 "write_db" $args
   set filename [file nativename [lindex $args 0]]
-  ord::write_db_cmd $filename
+  set compress [info exists flags(-compress)]
+  ord::write_db_cmd $filename $compress
 }
 
 sta::define_cmd_args "assign_ndr" { -ndr name (-net name | -all_clocks) }
@@ -93,6 +93,8 @@ struct ParamStruct
   int minAccessPoints = -1;
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
+  std::string paCacheFile;
+  bool orderWorkersByDifficulty = false;
 };
 
 class TritonRoute
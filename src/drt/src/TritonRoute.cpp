@@ -1147,12 +1147,16 @@ void TritonRoute::readParams(const string& fileName)
                         "write_guide instead.");
         } else if (field == "save_guide_updates") {
           SAVE_GUIDE_UPDATES = true;
+        } else if (field == "order_workers_by_difficulty") {
+          ORDER_WORKERS_BY_DIFFICULTY = true;
         } else if (field == "outputMaze") {
           OUT_MAZE_FILE = value;
         } else if (field == "outputDRC") {
           DRC_RPT_FILE = value;
         } else if (field == "outputCMap") {
           CMAP_FILE = value;
+        } else if (field == "pinAccessCache") {
+          PA_CACHE_FILE = value;
         } else if (field == "threads") {
           logger_->warn(utl::DRT,
                         274,
@@ -1251,6 +1255,8 @@ void TritonRoute::setParams(const ParamStruct& params)
   }
   SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
   REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
+  PA_CACHE_FILE = params.paCacheFile;
+  ORDER_WORKERS_BY_DIFFICULTY = params.orderWorkersByDifficulty;
 }
 
 void TritonRoute::addWorkerResults(
@@ -94,7 +94,9 @@ void detailed_route_cmd(const char* outputMazeFile,
                         bool singleStepDR,
                         int minAccessPoints,
                         bool saveGuideUpdates,
-                        const char* repairPDNLayerName)
+                        const char* repairPDNLayerName,
+                        const char* paCacheFile,
+                        bool orderWorkersByDifficulty)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   router->setParams({outputMazeFile,
@@ -116,7 +118,9 @@ void detailed_route_cmd(const char* outputMazeFile,
                     singleStepDR,
                     minAccessPoints,
                     saveGuideUpdates,
-                    repairPDNLayerName});
+                    repairPDNLayerName,
+                    paCacheFile,
+                    orderWorkersByDifficulty});
   router->main();
   router->setDistributed(false);
 }
@@ -125,7 +129,8 @@ void pin_access_cmd(const char* dbProcessNode,
                     const char* bottomRoutingLayer,
                     const char* topRoutingLayer,
                     int verbose,
-                    int minAccessPoints)
+                    int minAccessPoints,
+                    const char* paCacheFile)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   triton_route::ParamStruct params;
@@ -134,6 +139,7 @@ void pin_access_cmd(const char* dbProcessNode,
   params.topRoutingLayer = topRoutingLayer;
   params.verbose = verbose;
   params.minAccessPoints = minAccessPoints;
+  params.paCacheFile = paCacheFile;
   router->setParams(params);
   router->pinAccess();
   router->setDistributed(false);
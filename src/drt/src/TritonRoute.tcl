@@ -59,6 +59,8 @@ sta::define_cmd_args "detailed_route" {
     [-min_access_points count]
     [-save_guide_updates]
     [-repair_pdn_vias layer]
+    [-pin_access_cache filename]
+    [-order_workers_by_difficulty]
 }
 
 proc detailed_route { args } {
@@ -67,8 +69,9 @@ proc detailed_route { args } {
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias} \
-    flags {-disable_via_gen -distributed -clean_patches -no_pin_access -single_step_dr -save_guide_updates}
+      -cloud_size -min_access_points -repair_pdn_vias -pin_access_cache} \
+    flags {-disable_via_gen -distributed -clean_patches -no_pin_access -single_step_dr -save_guide_updates \
+      -order_workers_by_difficulty}
   sta::check_argc_eq0 "detailed_route" $args
 
   set enable_via_gen [expr ![info exists flags(-disable_via_gen)]]
@@ -78,6 +81,8 @@ proc detailed_route { args } {
   # development.  It is not listed in the help string intentionally.
   set single_step_dr  [expr [info exists flags(-single_step_dr)]]
   set save_guide_updates  [expr [info exists flags(-save_guide_updates)]]
+  set order_workers_by_difficulty \
+    [expr [info exists flags(-order_workers_by_difficulty)]]
   if { [info exists keys(-param)] } {
     if { [array size keys] > 1 } {
       utl::error DRT 251 "-param cannot be used with other arguments"
@@ -191,11 +196,17 @@ proc detailed_route { args } {
     } else {
       set min_access_points -1
     }
+    if { [info exists keys(-pin_access_cache)] } {
+      set pin_access_cache $keys(-pin_access_cache)
+    } else {
+      set pin_access_cache ""
+    }
     drt::detailed_route_cmd $output_maze $output_drc $output_cmap \
       $output_guide_coverage $db_process_node $enable_via_gen $droute_end_iter \
       $via_in_pin_bottom_layer $via_in_pin_top_layer \
       $or_seed $or_k $bottom_routing_layer $top_routing_layer $verbose \
-      $clean_patches $no_pin_access $single_step_dr $min_access_points $save_guide_updates $repair_pdn_vias
+      $clean_patches $no_pin_access $single_step_dr $min_access_points $save_guide_updates $repair_pdn_vias \
+      $pin_access_cache $order_workers_by_difficulty
   }
 }
 
@@ -285,6 +296,7 @@ sta::define_cmd_args "pin_access" {
     [-bottom_routing_layer layer]
     [-top_routing_layer layer]
     [-min_access_points count]
+    [-pin_access_cache filename]
     [-verbose level]
     [-distributed]
     [-remote_host rhost]
@@ -295,7 +307,8 @@ sta::define_cmd_args "pin_access" {
 proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
       keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
-            -min_access_points -remote_host -remote_port -shared_volume -cloud_size } \
+            -min_access_points -pin_access_cache -remote_host -remote_port \
+            -shared_volume -cloud_size } \
       flags {-distributed}
   sta::check_argc_eq0 "detailed_route_debug" $args
   if [info exists keys(-db_process_node)] {
@@ -325,6 +338,11 @@ proc pin_access { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
   if { [info exists flags(-distributed)] } {
     if { [info exists keys(-remote_host)] } {
       set rhost $keys(-remote_host)
@@ -348,7 +366,8 @@ proc pin_access { args } {
     }
     drt::detailed_route_distributed $rhost $rport $vol $cloudsz
   }
-  drt::pin_access_cmd $db_process_node $bottom_routing_layer $top_routing_layer $verbose $min_access_points
+  drt::pin_access_cmd $db_process_node $bottom_routing_layer $top_routing_layer $verbose $min_access_points \
+    $pin_access_cache
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
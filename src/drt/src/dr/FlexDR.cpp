@@ -36,9 +36,13 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <numeric>
+#include <queue>
+#include <shared_mutex>
 #include <sstream>
 
 #include "db/infra/frTime.h"
@@ -134,7 +138,10 @@ void FlexDR::setDebug(frDebugSettings* settings)
 
 std::string FlexDRWorker::reloadedMain()
 {
+  using namespace std::chrono;
+  high_resolution_clock::time_point t0 = high_resolution_clock::now();
   init(design_);
+  high_resolution_clock::time_point t1 = high_resolution_clock::now();
   debugPrint(logger_,
              utl::DRT,
              "autotuner",
@@ -142,6 +149,16 @@ std::string FlexDRWorker::reloadedMain()
              "Init number of markers {}",
              getInitNumMarkers());
   route_queue();
+  high_resolution_clock::time_point t2 = high_resolution_clock::now();
+  init_time_ = duration_cast<duration<double>>(t1 - t0).count();
+  route_time_ = duration_cast<duration<double>>(t2 - t1).count();
+  debugPrint(logger_,
+             utl::DRT,
+             "autotuner",
+             1,
+             "Init time {:.3f}s, route time {:.3f}s",
+             init_time_,
+             route_time_);
   setGCWorker(nullptr);
   cleanup();
   std::string workerStr;
@@ -163,6 +180,11 @@ int FlexDRWorker::main(frDesign* design)
 {
   ProfileTask profile("DRW:main");
   using namespace std::chrono;
+  // other workers can't commit to the design while it is read
+  std::shared_lock<std::shared_mutex> design_lock;
+  if (design_mutex_) {
+    design_lock = std::shared_lock<std::shared_mutex>(*design_mutex_);
+  }
   high_resolution_clock::time_point t0 = high_resolution_clock::now();
   auto micronPerDBU = 1.0 / getTech()->getDBUPerUU();
   if (VERBOSE > 1) {
@@ -206,6 +228,11 @@ int FlexDRWorker::main(frDesign* design)
   if (!skipRouting_) {
     init(design);
   }
+  // route_queue only reads the worker's copies made in init() (including
+  // the pin terms for hasAccessPoint) so other workers may end() now
+  if (design_lock.owns_lock()) {
+    design_lock.unlock();
+  }
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   if (!skipRouting_) {
     route_queue();
@@ -218,6 +245,8 @@ int FlexDRWorker::main(frDesign* design)
   duration<double> time_span0 = duration_cast<duration<double>>(t1 - t0);
   duration<double> time_span1 = duration_cast<duration<double>>(t2 - t1);
   duration<double> time_span2 = duration_cast<duration<double>>(t3 - t2);
+  init_time_ = time_span0.count();
+  route_time_ = time_span1.count();
 
   if (VERBOSE > 1) {
     stringstream ss;
@@ -446,6 +475,211 @@ void FlexDR::getBatchInfo(int& batchStepX, int& batchStepY)
   batchStepY = 2;
 }
 
+// Estimated routing effort of a worker: the violations left in its clip by the
+// previous iteration and then the number of route guides crossing it, which
+// reflects the global routing congestion (and is all there is in the first
+// iteration).
+std::pair<int, int> FlexDR::getWorkerDifficulty(
+    const FlexDRWorker* worker) const
+{
+  auto regionQuery = getDesign()->getRegionQuery();
+  vector<frMarker*> markers;
+  regionQuery->queryMarker(worker->getRouteBox(), markers);
+  vector<frGuide*> guides;
+  regionQuery->queryGuide(worker->getRouteBox(), guides);
+  return {markers.size(), guides.size()};
+}
+
+// Run the workers of an iteration following their dependencies instead of in
+// checkerboard batches. A worker depends on its neighbors that come first in
+// the batch order (see getBatchInfo) and starts once they are committed, so it
+// sees the same design as in the batched flow. Workers only read the design in
+// their init, under a shared lock, and the commits take the lock exclusively.
+// Hence maze routing overlaps the init and commit of other workers, and the
+// threads pick up the next ready worker instead of waiting for a whole batch.
+// With ORDER_WORKERS_BY_DIFFICULTY the hardest ready worker is picked first so
+// the long workers do not end up last; otherwise they run in ready order.
+void FlexDR::searchRepairWorkers(vector<unique_ptr<FlexDRWorker>>& workers,
+                                 const int numX,
+                                 const int numY,
+                                 const std::function<void()>& reportProgress)
+{
+  ProfileTask profile("DR:workers");
+  using namespace std::chrono;
+  int batchStepX, batchStepY;
+  getBatchInfo(batchStepX, batchStepY);
+  // position of a worker in the batched flow
+  auto batchOrder = [&](const int idx) {
+    const int batchIdx
+        = (idx / numY % batchStepX) * batchStepY + idx % numY % batchStepY;
+    return std::make_pair(batchIdx, idx);
+  };
+
+  const int numWorkers = workers.size();
+  vector<int> numPreds(numWorkers, 0);
+  vector<vector<int>> succs(numWorkers);
+  for (int idx = 0; idx < numWorkers; idx++) {
+    const int x = idx / numY;
+    const int y = idx % numY;
+    for (int nx = max(x - 1, 0); nx <= min(x + 1, numX - 1); nx++) {
+      for (int ny = max(y - 1, 0); ny <= min(y + 1, numY - 1); ny++) {
+        const int nbr = nx * numY + ny;
+        if (batchOrder(nbr) < batchOrder(idx)) {
+          succs[nbr].push_back(idx);
+          numPreds[idx]++;
+        }
+      }
+    }
+  }
+
+  vector<std::pair<int, int>> difficulties(numWorkers);
+  if (ORDER_WORKERS_BY_DIFFICULTY) {
+    for (int idx = 0; idx < numWorkers; idx++) {
+      difficulties[idx] = getWorkerDifficulty(workers[idx].get());
+    }
+  }
+  // difficulty, reverse ready order and worker index
+  using ReadyEntry = std::tuple<std::pair<int, int>, int, int>;
+  std::priority_queue<ReadyEntry> ready;
+  int numReady = 0;
+  auto pushReady = [&](const int idx) {
+    ready.emplace(difficulties[idx], -(numReady++), idx);
+  };
+  for (int idx = 0; idx < numWorkers; idx++) {
+    if (numPreds[idx] == 0) {
+      pushReady(idx);
+    }
+  }
+  int numPending = numWorkers;
+  std::mutex readyMutex;
+  std::condition_variable readyCond;
+  std::shared_mutex designMutex;
+
+  struct WorkerTimes
+  {
+    Rect gcellBox;
+    double init = 0;
+    double route = 0;
+    double commit = 0;
+  };
+  vector<WorkerTimes> times(numWorkers);
+  vector<double> idleTimes(MAX_THREADS, 0);
+
+  ThreadException exception;
+#pragma omp parallel num_threads(MAX_THREADS)
+  {
+    while (true) {
+      int idx;
+      {
+        const auto t0 = high_resolution_clock::now();
+        std::unique_lock<std::mutex> lock(readyMutex);
+        readyCond.wait(lock, [&] { return !ready.empty() || numPending == 0; });
+        idleTimes[omp_get_thread_num()]
+            += duration<double>(high_resolution_clock::now() - t0).count();
+        if (ready.empty()) {
+          break;
+        }
+        idx = std::get<2>(ready.top());
+        ready.pop();
+      }
+      try {
+        FlexDRWorker* worker = workers[idx].get();
+        worker->setDesignMutex(&designMutex);
+        worker->main(getDesign());
+        const auto t0 = high_resolution_clock::now();
+        {
+          std::unique_lock<std::shared_mutex> lock(designMutex);
+          if (worker->end(getDesign())) {
+            numWorkUnits_ += 1;
+          }
+          if (worker->isCongested()) {
+            increaseClipsize_ = true;
+          }
+          reportProgress();
+        }
+        const auto t1 = high_resolution_clock::now();
+        times[idx] = {worker->getGCellBox(),
+                      worker->getInitTime(),
+                      worker->getRouteTime(),
+                      duration<double>(t1 - t0).count()};
+        workers[idx].reset();
+      } catch (...) {
+        exception.capture();
+      }
+      {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        numPending--;
+        for (const int succ : succs[idx]) {
+          if (--numPreds[succ] == 0) {
+            pushReady(succ);
+          }
+        }
+      }
+      readyCond.notify_all();
+    }
+  }
+  exception.rethrow();
+
+  if (logger_->debugCheck(DRT, "workers", 1)) {
+    WorkerTimes total;
+    int slowest = -1;
+    double slowestTime = -1;
+    for (int idx = 0; idx < numWorkers; idx++) {
+      const WorkerTimes& wt = times[idx];
+      total.init += wt.init;
+      total.route += wt.route;
+      total.commit += wt.commit;
+      if (wt.init + wt.route + wt.commit > slowestTime) {
+        slowestTime = wt.init + wt.route + wt.commit;
+        slowest = idx;
+      }
+      debugPrint(logger_,
+                 DRT,
+                 "workers",
+                 2,
+                 "Worker ({} {}) ({} {}) init {:.3f}s route {:.3f}s commit "
+                 "{:.3f}s.",
+                 wt.gcellBox.xMin(),
+                 wt.gcellBox.yMin(),
+                 wt.gcellBox.xMax(),
+                 wt.gcellBox.yMax(),
+                 wt.init,
+                 wt.route,
+                 wt.commit);
+    }
+    const double idle
+        = std::accumulate(idleTimes.begin(), idleTimes.end(), 0.0);
+    debugPrint(logger_,
+               DRT,
+               "workers",
+               1,
+               "{} workers with {} threads: init {:.2f}s route {:.2f}s commit "
+               "{:.2f}s idle {:.2f}s.",
+               numWorkers,
+               MAX_THREADS,
+               total.init,
+               total.route,
+               total.commit,
+               idle);
+    if (slowest >= 0) {
+      const WorkerTimes& wt = times[slowest];
+      debugPrint(logger_,
+                 DRT,
+                 "workers",
+                 1,
+                 "Slowest worker ({} {}) ({} {}): init {:.2f}s route {:.2f}s "
+                 "commit {:.2f}s.",
+                 wt.gcellBox.xMin(),
+                 wt.gcellBox.yMin(),
+                 wt.gcellBox.xMax(),
+                 wt.gcellBox.yMax(),
+                 wt.init,
+                 wt.route,
+                 wt.commit);
+    }
+  }
+}
+
 void FlexDR::searchRepair(const SearchRepairArgs& args)
 {
   const int iter = iter_++;
@@ -498,13 +732,6 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   bool isExceed = false;
 
   vector<unique_ptr<FlexDRWorker>> uworkers;
-  int batchStepX, batchStepY;
-
-  getBatchInfo(batchStepX, batchStepY);
-
-  vector<vector<vector<unique_ptr<FlexDRWorker>>>> workers(batchStepX
-                                                           * batchStepY);
-
   int xIdx = 0, yIdx = 0;
   for (int i = offset; i < (int) xgp.getCount(); i += size) {
     for (int j = offset; j < (int) ygp.getCount(); j += size) {
@@ -548,24 +775,65 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
                       workerFixedShapeCost,
                       workerMarkerDecay);
 
+      uworkers.push_back(std::move(worker));
+
+      yIdx++;
+    }
+    yIdx = 0;
+    xIdx++;
+  }
+  const int numX = xIdx;
+  const int numY = xIdx > 0 ? uworkers.size() / numX : 0;
+
+  auto reportProgress = [&]() {
+    cnt++;
+    if (VERBOSE > 0) {
+      if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
+        if (prev_perc == 0 && t.isExceed(0)) {
+          isExceed = true;
+        }
+        prev_perc += 10;
+        if (isExceed) {
+          logger_->report("    Completing {}% with {} violations.",
+                          prev_perc,
+                          getDesign()->getTopBlock()->getNumMarkers());
+          logger_->report("    {}.", t);
+        }
+      }
+    }
+  };
+
+  increaseClipsize_ = false;
+  numWorkUnits_ = 0;
+  // distributed routing and worker dumps need the design to stay unchanged
+  // while a batch of workers runs
+  const bool batched = dist_on_ || router_->getDebugSettings()->debugDumpDR;
+  if (!batched) {
+    searchRepairWorkers(uworkers, numX, numY, reportProgress);
+  }
+
+  int batchStepX, batchStepY;
+
+  getBatchInfo(batchStepX, batchStepY);
+
+  vector<vector<vector<unique_ptr<FlexDRWorker>>>> workers(batchStepX
+                                                           * batchStepY);
+  if (batched) {
+    for (int idx = 0; idx < (int) uworkers.size(); idx++) {
+      xIdx = idx / numY;
+      yIdx = idx % numY;
       int batchIdx = (xIdx % batchStepX) * batchStepY + yIdx % batchStepY;
       if (workers[batchIdx].empty()
           || (!dist_on_
               && (int) workers[batchIdx].back().size() >= BATCHSIZE)) {
         workers[batchIdx].push_back(vector<unique_ptr<FlexDRWorker>>());
       }
-      workers[batchIdx].back().push_back(std::move(worker));
-
-      yIdx++;
+      workers[batchIdx].back().push_back(std::move(uworkers[idx]));
     }
-    yIdx = 0;
-    xIdx++;
   }
 
   omp_set_num_threads(MAX_THREADS);
   int version = 0;
-  increaseClipsize_ = false;
-  numWorkUnits_ = 0;
   // parallel execution
   for (auto& workerBatch : workers) {
     ProfileTask profile("DR:checkerboard");
@@ -586,35 +854,31 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
         }
         {
           ProfileTask task("DIST: PROCESS_BATCH");
+          // the workers of a batch are independent, so only the start order
+          // changes; they are still committed in batch order below
+          vector<int> order(workersInBatch.size());
+          std::iota(order.begin(), order.end(), 0);
+          if (ORDER_WORKERS_BY_DIFFICULTY) {
+            vector<std::pair<int, int>> difficulties;
+            for (auto& worker : workersInBatch) {
+              difficulties.push_back(getWorkerDifficulty(worker.get()));
+            }
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+              return difficulties[a] > difficulties[b];
+            });
+          }
           // multi thread
           ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
-          for (int i = 0; i < (int) workersInBatch.size(); i++) {
+          for (int j = 0; j < (int) workersInBatch.size(); j++) {
+            const int i = order[j];
             try {
               if (dist_on_)
                 workersInBatch[i]->distributedMain(getDesign());
               else
                 workersInBatch[i]->main(getDesign());
 #pragma omp critical
-              {
-                cnt++;
-                if (VERBOSE > 0) {
-                  if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1
-                      && prev_perc < 90) {
-                    if (prev_perc == 0 && t.isExceed(0)) {
-                      isExceed = true;
-                    }
-                    prev_perc += 10;
-                    if (isExceed) {
-                      logger_->report(
-                          "    Completing {}% with {} violations.",
-                          prev_perc,
-                          getDesign()->getTopBlock()->getNumMarkers());
-                      logger_->report("    {}.", t);
-                    }
-                  }
-                }
-              }
+              reportProgress();
             } catch (...) {
               exception.capture();
             }
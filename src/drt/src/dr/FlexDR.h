@@ -33,7 +33,9 @@
 #include <boost/polygon/polygon.hpp>
 #include <boost/serialization/export.hpp>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 
 #include "db/drObj/drMarker.h"
 #include "db/drObj/drNet.h"
@@ -169,6 +171,11 @@ class FlexDR
   void initFromTA();
   void initGCell2BoundaryPin();
   void getBatchInfo(int& batchStepX, int& batchStepY);
+  std::pair<int, int> getWorkerDifficulty(const FlexDRWorker* worker) const;
+  void searchRepairWorkers(std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+                           int numX,
+                           int numY,
+                           const std::function<void()>& reportProgress);
 
   void init_halfViaEncArea();
 
@@ -191,7 +198,11 @@ class FlexDRWorkerRegionQuery
   void query(const Rect& box,
              const frLayerNum layerNum,
              std::vector<rq_box_value_t<drConnFig*>>& result) const;
+  void queryTerms(const Rect& box,
+                  const frLayerNum layerNum,
+                  std::vector<frBlockObject*>& result) const;
   void init();
+  void initTerms(const frDesign* design);
   void cleanup();
   bool isEmpty() const;
 
@@ -277,7 +288,10 @@ class FlexDRWorker
         dist_port_(0),
         dist_on_(false),
         isCongested_(false),
-        save_updates_(false)
+        save_updates_(false),
+        design_mutex_(nullptr),
+        init_time_(0),
+        route_time_(0)
   {
   }
   FlexDRWorker()
@@ -306,7 +320,10 @@ class FlexDRWorker
         dist_port_(0),
         dist_on_(false),
         isCongested_(false),
-        save_updates_(false)
+        save_updates_(false),
+        design_mutex_(nullptr),
+        init_time_(0),
+        route_time_(0)
   {
   }
   // setters
@@ -396,6 +413,8 @@ class FlexDRWorker
     gridGraph_.setGraphics(in);
   }
   void setViaData(FlexDRViaData* viaData) { via_data_ = viaData; }
+  // main() reads the design under a shared lock of this mutex
+  void setDesignMutex(std::shared_mutex* in) { design_mutex_ = in; }
   // getters
   frTechObject* getTech() const { return design_->getTech(); }
   void getRouteBox(Rect& boxIn) const { boxIn = routeBox_; }
@@ -470,6 +489,9 @@ class FlexDRWorker
   const vector<Point3D> getSpecialAccessAPs() const { return specialAccessAPs; }
   frCoord getHalfViaEncArea(frMIdx z, bool isLayer1, frNonDefaultRule* ndr);
   bool isSkipRouting() const { return skipRouting_; }
+  // seconds spent by main() in init and in maze routing
+  double getInitTime() const { return init_time_; }
+  double getRouteTime() const { return route_time_; }
 
   enum ModCostType
   {
@@ -540,6 +562,9 @@ class FlexDRWorker
   bool dist_on_;
   bool isCongested_;
   bool save_updates_;
+  std::shared_mutex* design_mutex_;
+  double init_time_;
+  double route_time_;
 
   // init
   void init(const frDesign* design);
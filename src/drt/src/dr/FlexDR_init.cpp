@@ -3308,12 +3308,14 @@ void FlexDRWorker::init(const frDesign* design)
   initNets(design);
   initGridGraph(design);
   initMazeIdx();
+  getWorkerRegionQuery().initTerms(design);
   std::unique_ptr<FlexGCWorker> gcWorker
       = make_unique<FlexGCWorker>(design->getTech(), logger_, this);
   gcWorker->setExtBox(getExtBox());
   gcWorker->setDrcBox(getDrcBox());
   gcWorker->init(design);
   gcWorker->setEnableSurgicalFix(true);
+  gcWorker->setEnableIncremental(true);
   setGCWorker(std::move(gcWorker));
   initMazeCost(design);
 }
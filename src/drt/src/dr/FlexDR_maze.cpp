@@ -2628,20 +2628,20 @@ void FlexDRWorker::checkPathSegStyle(drPathSeg* ps,
 
 bool FlexDRWorker::hasAccessPoint(const Point& pt, frLayerNum lNum, frNet* net)
 {
-  frRegionQuery::Objects<frBlockObject> result;
+  vector<frBlockObject*> result;
   Rect bx(pt.x(), pt.y(), pt.x(), pt.y());
-  design_->getRegionQuery()->query(bx, lNum, result);
-  for (auto& rqObj : result) {
-    switch (rqObj.second->typeId()) {
+  getWorkerRegionQuery().queryTerms(bx, lNum, result);
+  for (auto obj : result) {
+    switch (obj->typeId()) {
       case frcInstTerm: {
-        auto instTerm = static_cast<frInstTerm*>(rqObj.second);
+        auto instTerm = static_cast<frInstTerm*>(obj);
         if (instTerm->getNet() == net
             && instTerm->hasAccessPoint(pt.x(), pt.y(), lNum))
           return true;
         break;
       }
       case frcBTerm: {
-        auto term = static_cast<frBTerm*>(rqObj.second);
+        auto term = static_cast<frBTerm*>(obj);
         if (term->getNet() == net
             && term->hasAccessPoint(pt.x(), pt.y(), lNum, 0))
           return true;
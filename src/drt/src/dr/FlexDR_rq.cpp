@@ -42,6 +42,9 @@ struct FlexDRWorkerRegionQuery::Impl
 {
   FlexDRWorker* drWorker;
   std::vector<RTree<drConnFig*>> shapes_;  // only for drXXX in dr worker
+  // inst terms and bterms of the design in the ext box, copied in
+  // initTerms() so routing doesn't read the design region query
+  std::vector<RTree<frBlockObject*>> terms_;
 
   static void add(
       drConnFig* connFig,
@@ -62,6 +65,8 @@ void FlexDRWorkerRegionQuery::cleanup()
 {
   impl_->shapes_.clear();
   impl_->shapes_.shrink_to_fit();
+  impl_->terms_.clear();
+  impl_->terms_.shrink_to_fit();
 }
 
 void FlexDRWorkerRegionQuery::add(drConnFig* connFig)
@@ -237,6 +242,18 @@ void FlexDRWorkerRegionQuery::query(
                                     back_inserter(result));
 }
 
+void FlexDRWorkerRegionQuery::queryTerms(const Rect& box,
+                                         const frLayerNum layerNum,
+                                         vector<frBlockObject*>& result) const
+{
+  vector<rq_box_value_t<frBlockObject*>> temp;
+  impl_->terms_.at(layerNum).query(bgi::intersects(box), back_inserter(temp));
+  result.reserve(temp.size());
+  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
+    return kv.second;
+  });
+}
+
 void FlexDRWorkerRegionQuery::init()
 {
   int numLayers = impl_->drWorker->getTech()->getLayers().size();
@@ -258,6 +275,26 @@ void FlexDRWorkerRegionQuery::init()
   }
 }
 
+void FlexDRWorkerRegionQuery::initTerms(const frDesign* design)
+{
+  int numLayers = impl_->drWorker->getTech()->getLayers().size();
+  impl_->terms_.clear();
+  impl_->terms_.resize(numLayers);
+  const Rect& extBox = impl_->drWorker->getExtBox();
+  for (auto i = 0; i < numLayers; i++) {
+    frRegionQuery::Objects<frBlockObject> result;
+    design->getRegionQuery()->query(extBox, i, result);
+    vector<rq_box_value_t<frBlockObject*>> terms;
+    for (auto& rqObj : result) {
+      auto type = rqObj.second->typeId();
+      if (type == frcInstTerm || type == frcBTerm) {
+        terms.push_back(rqObj);
+      }
+    }
+    impl_->terms_.at(i) = boost::move(RTree<frBlockObject*>(terms));
+  }
+}
+
 bool FlexDRWorkerRegionQuery::isEmpty() const
 {
   return impl_->shapes_.empty();
@@ -71,8 +71,13 @@ void FlexGridGraph::initGrids(
   getDim(xDim, yDim, zDim);
   const int capacity = xDim * yDim * zDim;
 
+  if (nodes_.capacity() < (size_t) capacity
+      && spareNodes().capacity() > nodes_.capacity()) {
+    nodes_.swap(spareNodes());
+  }
   nodes_.clear();
   nodes_.resize(capacity, Node());
+  markerCosts_.clear();
   // new
   prevDirs_.clear();
   srcs_.clear();
@@ -31,6 +31,7 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 
 #include "FlexMazeTypes.h"
 #include "db/drObj/drPin.h"
@@ -313,17 +314,23 @@ class FlexGridGraph
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostPlanar;
+      sol += getMarkerCostPlanar(idx);
     } else {
       correctU(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostVia;
+      sol += getMarkerCostVia(idx);
     }
     return (sol);
   }
   bool hasMarkerCostAdj(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir) const
   {
-    return getMarkerCostAdj(x, y, z, dir);
+    if (dir != frDirEnum::D && dir != frDirEnum::U) {
+      reverse(x, y, z, dir);
+      return nodes_[getIdx(x, y, z)].hasMarkerCostPlanar;
+    } else {
+      correctU(x, y, z, dir);
+      return nodes_[getIdx(x, y, z)].hasMarkerCostVia;
+    }
   }
   frCoord xCoord(frMIdx x) const { return xCoords_[x]; }
   frCoord yCoord(frMIdx y) const { return yCoords_[y]; }
@@ -501,26 +508,26 @@ class FlexGridGraph
   }
   void addMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
-    node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
+    auto idx = getIdx(x, y, z);
+    setMarkerCostPlanar(idx, addToByte(getMarkerCostPlanar(idx), 10));
   }
   void addMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
-    node.markerCostVia = addToByte(node.markerCostVia, 10);
+    auto idx = getIdx(x, y, z);
+    setMarkerCostVia(idx, addToByte(getMarkerCostVia(idx), 10));
   }
   void addMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
     correct(x, y, z, dir);
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      auto idx = getIdx(x, y, z);
       switch (dir) {
         case frDirEnum::E:
         case frDirEnum::N:
-          node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
+          setMarkerCostPlanar(idx, addToByte(getMarkerCostPlanar(idx), 10));
           break;
         case frDirEnum::U:
-          node.markerCostVia = addToByte(node.markerCostVia, 10);
+          setMarkerCostVia(idx, addToByte(getMarkerCostVia(idx), 10));
           break;
         default:;
       }
@@ -529,41 +536,37 @@ class FlexGridGraph
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z, float d)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostPlanar;
+    int currCost = getMarkerCostPlanar(idx);
     currCost *= d;
     currCost = std::max(0, currCost);
-    node.markerCostPlanar = currCost;
+    setMarkerCostPlanar(idx, currCost);
     return (currCost == 0);
   }
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z, float d)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostVia;
+    int currCost = getMarkerCostVia(idx);
     currCost *= d;
     currCost = std::max(0, currCost);
-    node.markerCostVia = currCost;
+    setMarkerCostVia(idx, currCost);
     return (currCost == 0);
   }
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostPlanar;
+    int currCost = getMarkerCostPlanar(idx);
     currCost--;
     currCost = std::max(0, currCost);
-    node.markerCostPlanar = currCost;
+    setMarkerCostPlanar(idx, currCost);
     return (currCost == 0);
   }
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostVia;
+    int currCost = getMarkerCostVia(idx);
     currCost--;
     currCost = std::max(0, currCost);
-    node.markerCostVia = currCost;
+    setMarkerCostVia(idx, currCost);
     return (currCost == 0);
   }
   bool decayMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir, float d)
@@ -571,23 +574,23 @@ class FlexGridGraph
     correct(x, y, z, dir);
     int currCost = 0;
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      auto idx = getIdx(x, y, z);
       switch (dir) {
         case frDirEnum::E:
-          currCost = node.markerCostPlanar;
+          currCost = getMarkerCostPlanar(idx);
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostPlanar = currCost;
+          setMarkerCostPlanar(idx, currCost);
         case frDirEnum::N:
-          currCost = node.markerCostPlanar;
+          currCost = getMarkerCostPlanar(idx);
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostPlanar = currCost;
+          setMarkerCostPlanar(idx, currCost);
         case frDirEnum::U:
-          currCost = node.markerCostVia;
+          currCost = getMarkerCostVia(idx);
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostVia = currCost;
+          setMarkerCostVia(idx, currCost);
         default:;
       }
     }
@@ -845,8 +848,8 @@ class FlexGridGraph
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
-    nodes_.clear();
-    nodes_.shrink_to_fit();
+    releaseNodes();
+    markerCosts_.clear();
     srcs_.clear();
     srcs_.shrink_to_fit();
     dsts_.clear();
@@ -885,8 +888,9 @@ class FlexGridGraph
     cout << "hasGridCostUp " << n.hasGridCostUp << "\n";
     cout << "routeShapeCostPlanar " << n.routeShapeCostPlanar << "\n";
     cout << "routeShapeCostVia " << n.routeShapeCostVia << "\n";
-    cout << "markerCostPlanar " << n.markerCostPlanar << "\n";
-    cout << "markerCostVia " << n.markerCostVia << "\n";
+    cout << "markerCostPlanar " << getMarkerCostPlanar(getIdx(x, y, z))
+         << "\n";
+    cout << "markerCostVia " << getMarkerCostVia(getIdx(x, y, z)) << "\n";
     cout << "fixedShapeCostVia " << n.fixedShapeCostVia << "\n";
     cout << "fixedShapeCostPlanar " << n.fixedShapeCostPlanar << "\n";
   }
@@ -903,52 +907,67 @@ class FlexGridGraph
   static constexpr int cost_bits = 8;
 #endif
 
+  // Marker costs are only set around the markers of the worker, so their
+  // values are kept in markerCosts_ and the node only records whether they
+  // are non-zero, which is all the maze search needs.
   struct Node
   {
     Node() { std::memset(this, 0, sizeof(Node)); }
     // Byte 0
-    frUInt4 hasEastEdge : 1;
-    frUInt4 hasNorthEdge : 1;
-    frUInt4 hasUpEdge : 1;
-    frUInt4 isBlockedEast : 1;
-    frUInt4 isBlockedNorth : 1;
-    frUInt4 isBlockedUp : 1;
-    frUInt4 unused1 : 1;
-    frUInt4 unused2 : 1;
+    uint16_t hasEastEdge : 1;
+    uint16_t hasNorthEdge : 1;
+    uint16_t hasUpEdge : 1;
+    uint16_t isBlockedEast : 1;
+    uint16_t isBlockedNorth : 1;
+    uint16_t isBlockedUp : 1;
+    uint16_t hasMarkerCostPlanar : 1;
+    uint16_t hasMarkerCostVia : 1;
     // Byte 1
-    frUInt4 hasSpecialVia : 1;
-    frUInt4 overrideShapeCostVia : 1;
-    frUInt4 hasGridCostEast : 1;
-    frUInt4 hasGridCostNorth : 1;
-    frUInt4 hasGridCostUp : 1;
-    frUInt4 unused3 : 1;
-    frUInt4 unused4 : 1;
-    frUInt4 unused5 : 1;
+    uint16_t hasSpecialVia : 1;
+    uint16_t overrideShapeCostVia : 1;
+    uint16_t hasGridCostEast : 1;
+    uint16_t hasGridCostNorth : 1;
+    uint16_t hasGridCostUp : 1;
+    uint16_t unused3 : 1;
+    uint16_t unused4 : 1;
+    uint16_t unused5 : 1;
     // Byte 2
-    frUInt4 routeShapeCostPlanar : cost_bits;
+    uint16_t routeShapeCostPlanar : cost_bits;
     // Byte 3
-    frUInt4 routeShapeCostVia : cost_bits;
-    // Byte4
-    frUInt4 markerCostPlanar : cost_bits;
-    // Byte5
-    frUInt4 markerCostVia : cost_bits;
-    // Byte6
-    frUInt4 fixedShapeCostVia : cost_bits;
-    // Byte7
-    frUInt4 fixedShapeCostPlanar : cost_bits;
+    uint16_t routeShapeCostVia : cost_bits;
+    // Byte 4
+    uint16_t fixedShapeCostVia : cost_bits;
+    // Byte 5
+    uint16_t fixedShapeCostPlanar : cost_bits;
 
     template <class Archive>
     void serialize(Archive& ar, const unsigned int version)
     {
-      uint64_t* val = reinterpret_cast<uint64_t*>(this);
-      (ar) & *val;
+      uint16_t* val = reinterpret_cast<uint16_t*>(this);
+      for (size_t i = 0; i < sizeof(Node) / sizeof(uint16_t); i++) {
+        (ar) & val[i];
+      }
     }
     friend class boost::serialization::access;
   };
 #ifndef DEBUG_DRT_UNDERFLOW
-  static_assert(sizeof(Node) == 8);
+  static_assert(sizeof(Node) == 6);
 #endif
+  struct MarkerCost
+  {
+    frUInt4 planar = 0;
+    frUInt4 via = 0;
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version)
+    {
+      (ar) & planar;
+      (ar) & via;
+    }
+    friend class boost::serialization::access;
+  };
   frVector<Node> nodes_;
+  std::unordered_map<frMIdx, MarkerCost> markerCosts_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
   std::vector<bool> dsts_;
@@ -1051,6 +1070,55 @@ class FlexGridGraph
     return result;
   }
 
+  frUInt4 getMarkerCostPlanar(frMIdx idx) const
+  {
+    return nodes_[idx].hasMarkerCostPlanar ? markerCosts_.at(idx).planar : 0;
+  }
+  frUInt4 getMarkerCostVia(frMIdx idx) const
+  {
+    return nodes_[idx].hasMarkerCostVia ? markerCosts_.at(idx).via : 0;
+  }
+  void setMarkerCostPlanar(frMIdx idx, frUInt4 cost)
+  {
+    Node& node = nodes_[idx];
+    if (cost == 0 && !node.hasMarkerCostPlanar) {
+      return;
+    }
+    node.hasMarkerCostPlanar = (cost != 0);
+    markerCosts_[idx].planar = cost;
+    if (!node.hasMarkerCostPlanar && !node.hasMarkerCostVia) {
+      markerCosts_.erase(idx);
+    }
+  }
+  void setMarkerCostVia(frMIdx idx, frUInt4 cost)
+  {
+    Node& node = nodes_[idx];
+    if (cost == 0 && !node.hasMarkerCostVia) {
+      return;
+    }
+    node.hasMarkerCostVia = (cost != 0);
+    markerCosts_[idx].via = cost;
+    if (!node.hasMarkerCostPlanar && !node.hasMarkerCostVia) {
+      markerCosts_.erase(idx);
+    }
+  }
+
+  // The node storage of a finished worker is kept per thread and reused by
+  // the next worker routed on that thread instead of being freed.
+  static frVector<Node>& spareNodes()
+  {
+    thread_local frVector<Node> storage;
+    return storage;
+  }
+  void releaseNodes()
+  {
+    nodes_.clear();
+    if (nodes_.capacity() > spareNodes().capacity()) {
+      nodes_.swap(spareNodes());
+    }
+    nodes_.shrink_to_fit();
+  }
+
   frUInt4 subFromByte(frUInt4 minuend, frUInt4 subtrahend)
   {
 #ifdef DEBUG_DRT_UNDERFLOW
@@ -1215,6 +1283,7 @@ class FlexGridGraph
     }
     (ar) & drWorker_;
     (ar) & nodes_;
+    (ar) & markerCosts_;
     (ar) & prevDirs_;
     (ar) & srcs_;
     (ar) & dsts_;
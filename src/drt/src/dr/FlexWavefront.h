@@ -28,9 +28,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
+#include <cstdint>
 #include <memory>
-#include <queue>
+#include <vector>
 
 #include "dr/FlexMazeTypes.h"
 #include "frBaseTypes.h"
@@ -59,9 +61,9 @@ class FlexWavefrontGrid
         vLengthX_(vLengthXIn),
         vLengthY_(vLengthYIn),
         dist_(distIn),
-        prevViaUp_(prevViaUpIn),
         tLength_(tLengthIn),
-        backTraceBuffer_(backTraceBufferIn)
+        prevViaUp_(prevViaUpIn),
+        backTraceBuffer_(backTraceBufferIn.to_ulong())
   {
   }
   bool operator<(const FlexWavefrontGrid& b) const
@@ -84,7 +86,8 @@ class FlexWavefrontGrid
   frMIdx z() const { return zIdx_; }
   frCost getPathCost() const { return pathCost_; }
   frCost getCost() const { return cost_; }
-  const std::bitset<WAVEFRONTBITSIZE>& getBackTraceBuffer() const
+  frCoord getDist() const { return dist_; }
+  std::bitset<WAVEFRONTBITSIZE> getBackTraceBuffer() const
   {
     return backTraceBuffer_;
   }
@@ -106,21 +109,22 @@ class FlexWavefrontGrid
   void setPrevViaUp(bool in) { prevViaUp_ = in; }
   frDirEnum getLastDir() const
   {
-    auto currDirVal = backTraceBuffer_.to_ulong() & 0b111u;
+    auto currDirVal = backTraceBuffer_ & 0b111u;
     return static_cast<frDirEnum>(currDirVal);
   }
   bool isBufferFull() const
   {
     std::bitset<WAVEFRONTBITSIZE> mask = WAVEFRONTBUFFERHIGHMASK;
-    return (mask & backTraceBuffer_).any();
+    return (mask & getBackTraceBuffer()).any();
   }
   frDirEnum shiftAddBuffer(const frDirEnum& dir)
   {
+    std::bitset<WAVEFRONTBITSIZE> buffer = backTraceBuffer_;
     auto retBS = static_cast<frDirEnum>(
-        (backTraceBuffer_ >> (WAVEFRONTBITSIZE - DIRBITSIZE)).to_ulong());
-    backTraceBuffer_ <<= DIRBITSIZE;
-    std::bitset<WAVEFRONTBITSIZE> newBS = (unsigned) dir;
-    backTraceBuffer_ |= newBS;
+        (buffer >> (WAVEFRONTBITSIZE - DIRBITSIZE)).to_ulong());
+    buffer <<= DIRBITSIZE;
+    buffer |= (unsigned) dir;
+    backTraceBuffer_ = buffer.to_ulong();
     return retBS;
   }
   void setSrcTaperBox(const frBox3D* b) { srcTaperBox = b; }
@@ -132,36 +136,53 @@ class FlexWavefrontGrid
   frCost cost_;      // path + est cost
   frCoord vLengthX_;
   frCoord vLengthY_;
-  frCoord dist_;  // to maze center
-  bool prevViaUp_;
+  frCoord dist_;     // to maze center
   frCoord tLength_;  // length since last turn
-  std::bitset<WAVEFRONTBITSIZE> backTraceBuffer_;
+  bool prevViaUp_;
+  uint8_t backTraceBuffer_;  // WAVEFRONTBITSIZE bits
   const frBox3D* srcTaperBox = nullptr;
 };
 
-class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
+// Priority queue of the maze search. It is a binary heap driven by the std
+// heap algorithms, so grids are popped in the same order as from a
+// std::priority_queue. The storage is kept across searches; fit() hands it
+// over to the next worker routed by the same thread instead of freeing it.
+class FlexWavefront
 {
  public:
-  void cleanup() { this->c.clear(); }
+  bool empty() const { return heap_.empty(); }
+  const FlexWavefrontGrid& top() const { return heap_.front(); }
+  void pop()
+  {
+    std::pop_heap(heap_.begin(), heap_.end());
+    heap_.pop_back();
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    if (heap_.capacity() == 0) {
+      heap_.swap(spare());
+    }
+    heap_.push_back(in);
+    std::push_heap(heap_.begin(), heap_.end());
+  }
+  unsigned int size() const { return heap_.size(); }
+  void cleanup() { heap_.clear(); }
   void fit()
   {
-    this->c.clear();
-    this->c.shrink_to_fit();
+    heap_.clear();
+    if (heap_.capacity() > spare().capacity()) {
+      heap_.swap(spare());
+    }
+    heap_.shrink_to_fit();
   }
-};
-
-class FlexWavefront
-{
- public:
-  bool empty() const { return wavefrontPQ_.empty(); }
-  const FlexWavefrontGrid& top() const { return wavefrontPQ_.top(); }
-  void pop() { wavefrontPQ_.pop(); }
-  void push(const FlexWavefrontGrid& in) { wavefrontPQ_.push(in); }
-  unsigned int size() const { return wavefrontPQ_.size(); }
-  void cleanup() { wavefrontPQ_.cleanup(); }
-  void fit() { wavefrontPQ_.fit(); }
 
  private:
-  myPriorityQueue wavefrontPQ_;
+  static std::vector<FlexWavefrontGrid>& spare()
+  {
+    thread_local std::vector<FlexWavefrontGrid> storage;
+    return storage;
+  }
+
+  std::vector<FlexWavefrontGrid> heap_;
 };
 }  // namespace fr
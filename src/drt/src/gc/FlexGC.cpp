@@ -70,12 +70,19 @@ FlexGCWorker::Impl::Impl(frTechObject* techIn,
       ignoreMinArea_(false),
       ignoreLongSideEOL_(false),
       ignoreCornerSpacing_(false),
-      surgicalFixEnabled_(false)
+      surgicalFixEnabled_(false),
+      incrementalEnabled_(false),
+      markerGroupsValid_(false),
+      markerGroupIdx_(-1),
+      currMarkerGroup_(-1)
 {
 }
 
 void FlexGCWorker::Impl::addMarker(std::unique_ptr<frMarker> in)
 {
+  if (currMarkerGroup_ >= 0) {
+    markerGroups_[currMarkerGroup_].push_back(*in);
+  }
   Rect bbox = in->getBBox();
   auto layerNum = in->getLayerNum();
   auto con = in->getConstraint();
@@ -176,6 +183,16 @@ void FlexGCWorker::setEnableSurgicalFix(bool in)
   impl_->surgicalFixEnabled_ = in;
 }
 
+void FlexGCWorker::setEnableIncremental(bool in)
+{
+  impl_->incrementalEnabled_ = in;
+  if (!in) {
+    impl_->markerGroupsValid_ = false;
+    impl_->markerGroups_.clear();
+    impl_->dirtyBoxes_.clear();
+  }
+}
+
 void FlexGCWorker::resetTargetNet()
 {
   impl_->targetNet_ = nullptr;
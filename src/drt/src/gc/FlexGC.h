@@ -60,6 +60,7 @@ class FlexGCWorker
   void setIgnoreLongSideEOL();
   void setIgnoreCornerSpacing();
   void setEnableSurgicalFix(bool in);
+  void setEnableIncremental(bool in);
   void addPAObj(frConnFig* obj, frBlockObject* owner);
   // getters
   std::vector<std::unique_ptr<gcNet>>& getNets();
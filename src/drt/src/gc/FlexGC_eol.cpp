@@ -1226,6 +1226,9 @@ void FlexGCWorker::Impl::checkMetalEndOfLine()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!startNetCheck(net.get(), i)) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           checkMetalEndOfLine_main(pin.get());
         }
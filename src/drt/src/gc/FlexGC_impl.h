@@ -168,6 +168,21 @@ class FlexGCWorker::Impl
   bool ignoreCornerSpacing_;
   bool surgicalFixEnabled_;
 
+  // incremental checks of the whole worker: the markers added for each
+  // (check, layer, net) visited by the last untargeted check are kept, in
+  // visiting order and before de-duplication. The next untargeted check only
+  // re-checks the nets near the shapes updated since then and replays the
+  // kept markers of the others, so it reports the same markers in the same
+  // order as a full check.
+  bool incrementalEnabled_;
+  bool markerGroupsValid_;
+  int markerGroupIdx_;   // -1 if no untargeted check is running
+  int currMarkerGroup_;  // -1 if added markers are not kept
+  std::vector<std::vector<frMarker>> markerGroups_;
+  // layer --> bounding boxes of the nets updated since the last untargeted
+  // check, before and after the update
+  std::vector<std::vector<Rect>> dirtyBoxes_;
+
   FlexGCWorkerRegionQuery& getWorkerRegionQuery() { return rq_; }
 
   // init
@@ -216,6 +231,14 @@ class FlexGCWorker::Impl
 
   void initRegionQuery();
 
+  // incremental checks
+  bool getNetBox(gcNet* net, frLayerNum layerNum, Rect& box) const;
+  void addDirtyBoxes(gcNet* net);
+  bool isCleanNet(gcNet* net, frLayerNum layerNum) const;
+  void beginMarkerGroups();
+  void endMarkerGroups();
+  bool startNetCheck(gcNet* net, frLayerNum layerNum);
+
   void checkMetalSpacing();
   frCoord checkMetalSpacing_getMaxSpcVal(frLayerNum layerNum,
                                          bool checkNDRs = true);
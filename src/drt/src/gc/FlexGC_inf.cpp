@@ -244,10 +244,14 @@ void FlexGCWorker::Impl::checkMetalSpacingTableInfluence()
       }
       if (!currLayer->hasSpacingTableInfluence())
         continue;
-      for (auto& uNet : getNets())
+      for (auto& uNet : getNets()) {
+        if (!startNetCheck(uNet.get(), i)) {
+          continue;
+        }
         for (auto& pin : uNet.get()->getPins(i)) {
           checkPinMetSpcTblInf(pin.get());
         }
+      }
     }
   }
 }
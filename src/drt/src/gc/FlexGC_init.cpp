@@ -966,6 +966,9 @@ void FlexGCWorker::Impl::updateGCWorker()
   // start init from dr objs
   for (auto fnet : fnets) {
     auto net = owner2nets_[fnet];
+    if (incrementalEnabled_) {
+      addDirtyBoxes(net);
+    }
     getWorkerRegionQuery().removeFromRegionQuery(
         net);      // delete all region queries
     net->clear();  // delete all pins and routeXXX
@@ -1002,6 +1005,41 @@ void FlexGCWorker::Impl::updateGCWorker()
     // init gc net
     initNet(net);
     getWorkerRegionQuery().addToRegionQuery(net);
+    if (incrementalEnabled_) {
+      addDirtyBoxes(net);
+    }
+  }
+}
+
+bool FlexGCWorker::Impl::getNetBox(gcNet* net,
+                                   frLayerNum layerNum,
+                                   Rect& box) const
+{
+  bool found = false;
+  for (auto& pin : net->getPins(layerNum)) {
+    gtl::rectangle_data<frCoord> rect;
+    gtl::extents(rect, *pin->getPolygon());
+    Rect pinBox(gtl::xl(rect), gtl::yl(rect), gtl::xh(rect), gtl::yh(rect));
+    if (found) {
+      box.merge(pinBox);
+    } else {
+      box = pinBox;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void FlexGCWorker::Impl::addDirtyBoxes(gcNet* net)
+{
+  if (dirtyBoxes_.empty()) {
+    dirtyBoxes_.resize(getTech()->getLayers().size());
+  }
+  for (frLayerNum i = 0; i < (frLayerNum) dirtyBoxes_.size(); i++) {
+    Rect box;
+    if (getNetBox(net, i, box)) {
+      dirtyBoxes_[i].push_back(box);
+    }
   }
 }
 
@@ -906,6 +906,9 @@ void FlexGCWorker::Impl::checkMetalSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!startNetCheck(net.get(), i)) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             // Short, NSMetal, metSpc
@@ -1171,6 +1174,9 @@ void FlexGCWorker::Impl::checkMetalCornerSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!startNetCheck(net.get(), i)) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& corners : pin->getPolygonCorners()) {
             for (auto& corner : corners) {
@@ -1991,6 +1997,9 @@ void FlexGCWorker::Impl::checkMetalShape()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!startNetCheck(net.get(), i)) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           checkMetalShape_main(pin.get());
         }
@@ -3182,6 +3191,9 @@ void FlexGCWorker::Impl::checkCutSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!startNetCheck(net.get(), i)) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkCutSpacing_main(maxrect.get());
@@ -3498,6 +3510,9 @@ void FlexGCWorker::Impl::checkMinimumCut()
       if (!currLayer->hasMinimumcut())
         continue;
       for (auto& net : getNets()) {
+        if (!startNetCheck(net.get(), i)) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkMinimumCut_main(maxrect.get());
@@ -3508,6 +3523,74 @@ void FlexGCWorker::Impl::checkMinimumCut()
   }
 }
 
+// A net is clean if no shape updated since the last untargeted check is
+// within MTSAFEDIST of its shapes on the layer or the two layers above and
+// below, so the rules see the same shapes around it as back then.
+bool FlexGCWorker::Impl::isCleanNet(gcNet* net, frLayerNum layerNum) const
+{
+  Rect box;
+  if (!getNetBox(net, layerNum, box)) {
+    return false;
+  }
+  if (dirtyBoxes_.empty()) {
+    return true;
+  }
+  box.bloat(MTSAFEDIST, box);
+  const frLayerNum begin = std::max(layerNum - 2, 0);
+  const frLayerNum end
+      = std::min(layerNum + 2, (frLayerNum) dirtyBoxes_.size() - 1);
+  for (frLayerNum i = begin; i <= end; i++) {
+    for (auto& dirtyBox : dirtyBoxes_[i]) {
+      if (box.intersects(dirtyBox)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void FlexGCWorker::Impl::beginMarkerGroups()
+{
+  markerGroupIdx_ = 0;
+  currMarkerGroup_ = -1;
+}
+
+void FlexGCWorker::Impl::endMarkerGroups()
+{
+  if (markerGroupIdx_ < 0) {
+    return;
+  }
+  markerGroups_.resize(markerGroupIdx_);
+  markerGroupsValid_ = true;
+  markerGroupIdx_ = -1;
+  currMarkerGroup_ = -1;
+  for (auto& boxes : dirtyBoxes_) {
+    boxes.clear();
+  }
+}
+
+// Called for each net visited by the untargeted checks. Returns false if the
+// markers of the net are replayed from the last untargeted check instead.
+bool FlexGCWorker::Impl::startNetCheck(gcNet* net, frLayerNum layerNum)
+{
+  if (markerGroupIdx_ < 0) {
+    return true;
+  }
+  const int idx = markerGroupIdx_++;
+  if (idx == (int) markerGroups_.size()) {
+    markerGroups_.emplace_back();
+  } else if (markerGroupsValid_ && isCleanNet(net, layerNum)) {
+    currMarkerGroup_ = -1;
+    for (auto& marker : markerGroups_[idx]) {
+      addMarker(make_unique<frMarker>(marker));
+    }
+    return false;
+  }
+  markerGroups_[idx].clear();
+  currMarkerGroup_ = idx;
+  return true;
+}
+
 int FlexGCWorker::Impl::main()
 {
   // ProfileTask profile("GC:main");
@@ -3523,6 +3606,9 @@ int FlexGCWorker::Impl::main()
   }
   // clear existing markers
   clearMarkers();
+  if (incrementalEnabled_ && !targetNet_) {
+    beginMarkerGroups();
+  }
   // check LEF58CornerSpacing
   checkMetalCornerSpacing();
   // check Short, NSMet, MetSpc based on max rectangles
@@ -3539,5 +3625,6 @@ int FlexGCWorker::Impl::main()
   checkMinimumCut();
   // check LEF58_METALWIDTHVIATABLE
   checkMetalWidthViaTable();
+  endMarkerGroups();
   return 0;
 }
@@ -45,6 +45,7 @@ string OUT_MAZE_FILE;
 string DRC_RPT_FILE;
 string CMAP_FILE;
 string GUIDE_REPORT_FILE;
+string PA_CACHE_FILE;
 
 // to be removed
 int OR_SEED = -1;
@@ -70,6 +71,7 @@ bool CLEAN_PATCHES = false;
 bool DO_PA = true;
 bool SINGLE_STEP_DR = false;
 bool SAVE_GUIDE_UPDATES = false;
+bool ORDER_WORKERS_BY_DIFFICULTY = false;
 
 std::string VIAINPIN_BOTTOMLAYER_NAME;
 std::string VIAINPIN_TOPLAYER_NAME;
@@ -40,6 +40,7 @@ extern std::string OUT_MAZE_FILE;
 extern std::string DRC_RPT_FILE;
 extern std::string CMAP_FILE;
 extern std::string GUIDE_REPORT_FILE;
+extern std::string PA_CACHE_FILE;
 // to be removed
 extern int OR_SEED;
 extern double OR_K;
@@ -63,6 +64,7 @@ extern bool CLEAN_PATCHES;
 extern bool DO_PA;
 extern bool SINGLE_STEP_DR;
 extern bool SAVE_GUIDE_UPDATES;
+extern bool ORDER_WORKERS_BY_DIFFICULTY;
 // extern int TEST;
 extern std::string VIAINPIN_BOTTOMLAYER_NAME;
 extern std::string VIAINPIN_TOPLAYER_NAME;
@@ -30,9 +30,12 @@
 
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/io/ios_state.hpp>
 #include <boost/serialization/export.hpp>
+#include <boost/serialization/string.hpp>
 #include <chrono>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -108,11 +111,260 @@ void FlexPA::applyPatternsFile(const char* file_path)
   file.close();
 }
 
+static void hashPoint(std::size_t& seed, const Point& pt)
+{
+  boost::hash_combine(seed, pt.x());
+  boost::hash_combine(seed, pt.y());
+}
+
+static void hashRect(std::size_t& seed, const Rect& box)
+{
+  hashPoint(seed, box.ll());
+  hashPoint(seed, box.ur());
+}
+
+static void hashFig(std::size_t& seed, const frFig* fig)
+{
+  boost::hash_combine(seed, (int) fig->typeId());
+  switch (fig->typeId()) {
+    case frcRect:
+    case frcPathSeg:
+    case frcPatchWire: {
+      auto shape = static_cast<const frShape*>(fig);
+      boost::hash_combine(seed, shape->getLayerNum());
+      hashRect(seed, shape->getBBox());
+      break;
+    }
+    case frcPolygon: {
+      auto polygon = static_cast<const frPolygon*>(fig);
+      boost::hash_combine(seed, polygon->getLayerNum());
+      for (const auto& pt : polygon->getPoints()) {
+        hashPoint(seed, pt);
+      }
+      break;
+    }
+    case frcVia: {
+      auto via = static_cast<const frVia*>(fig);
+      boost::hash_combine(seed, via->getViaDef()->getName());
+      hashPoint(seed, via->getOrigin());
+      break;
+    }
+    default:
+      hashRect(seed, fig->getBBox());
+      break;
+  }
+}
+
+static std::size_t getMasterHash(const frMaster* master)
+{
+  std::size_t seed = 0;
+  hashRect(seed, master->getDieBox());
+  for (const auto& term : master->getTerms()) {
+    boost::hash_combine(seed, term->getName());
+    for (const auto& pin : term->getPins()) {
+      for (const auto& fig : pin->getFigs()) {
+        hashFig(seed, fig.get());
+      }
+    }
+  }
+  for (const auto& blockage : master->getBlockages()) {
+    for (const auto& fig : blockage->getPin()->getFigs()) {
+      hashFig(seed, fig.get());
+    }
+  }
+  return seed;
+}
+
+// Access points depend on the tech, the pin access settings and the fixed
+// shapes around the instances (pdn, blockages), so all of them are part of
+// the hash stored in the cache file.
+std::size_t FlexPA::getCacheHash() const
+{
+  const int version = 1;
+  std::size_t seed = 0;
+  boost::hash_combine(seed, version);
+  for (const auto& layer : getTech()->getLayers()) {
+    boost::hash_combine(seed, layer->getName());
+    boost::hash_combine(seed, (int) layer->getType().getValue());
+    boost::hash_combine(seed, (int) layer->getDir().getValue());
+    boost::hash_combine(seed, layer->getWidth());
+    boost::hash_combine(seed, layer->getMinWidth());
+    boost::hash_combine(seed, layer->getPitch());
+  }
+  for (const auto& viaDef : getTech()->getVias()) {
+    boost::hash_combine(seed, viaDef->getName());
+  }
+  boost::hash_combine(seed, DBPROCESSNODE);
+  boost::hash_combine(seed, BOTTOM_ROUTING_LAYER);
+  boost::hash_combine(seed, TOP_ROUTING_LAYER);
+  boost::hash_combine(seed, VIAINPIN_BOTTOMLAYERNUM);
+  boost::hash_combine(seed, VIAINPIN_TOPLAYERNUM);
+  boost::hash_combine(seed, VIA_ACCESS_LAYERNUM);
+  boost::hash_combine(seed, MINNUMACCESSPOINT_STDCELLPIN);
+  boost::hash_combine(seed, MINNUMACCESSPOINT_MACROCELLPIN);
+  boost::hash_combine(seed, USENONPREFTRACKS);
+
+  auto block = getDesign()->getTopBlock();
+  hashRect(seed, block->getDieBox());
+  for (auto tp : block->getTrackPatterns()) {
+    boost::hash_combine(seed, tp->getLayerNum());
+    boost::hash_combine(seed, tp->isHorizontal());
+    boost::hash_combine(seed, tp->getStartCoord());
+    boost::hash_combine(seed, tp->getNumTracks());
+    boost::hash_combine(seed, tp->getTrackSpacing());
+  }
+  for (const auto& snet : block->getSNets()) {
+    for (const auto& shape : snet->getShapes()) {
+      hashFig(seed, shape.get());
+    }
+    for (const auto& via : snet->getVias()) {
+      hashFig(seed, via.get());
+    }
+  }
+  for (const auto& blockage : block->getBlockages()) {
+    for (const auto& fig : blockage->getPin()->getFigs()) {
+      hashFig(seed, fig.get());
+    }
+  }
+  return seed;
+}
+
+void FlexPA::readPACache()
+{
+  ProfileTask profile("PA:readCache");
+  std::map<frMaster*, std::size_t> masterHashes;
+  for (auto& [master, orientMap] : masterOT2Insts) {
+    masterHashes[master] = getMasterHash(master);
+    for (auto& [orient, offsetMap] : orientMap) {
+      for (auto& [offsets, insts] : offsetMap) {
+        std::string key = fmt::format("{} {} {:x}",
+                                      master->getName(),
+                                      orient.getString(),
+                                      masterHashes[master]);
+        for (auto offset : offsets) {
+          key += fmt::format(" {}", offset);
+        }
+        unique2CacheKey_[inst2unique_[*(insts.begin())]] = key;
+      }
+    }
+  }
+
+  std::ifstream file(PA_CACHE_FILE, std::ios::binary);
+  if (!file.good()) {
+    return;
+  }
+  try {
+    frIArchive ar(file);
+    ar.setDesign(design_);
+    registerTypes(ar);
+    std::size_t hash;
+    ar >> hash;
+    if (hash != getCacheHash()) {
+      logger_->warn(DRT,
+                    152,
+                    "Pin access cache {} does not match the current tech or "
+                    "floorplan, ignoring it.",
+                    PA_CACHE_FILE);
+      return;
+    }
+    ar >> paCache_;
+  } catch (const std::exception& e) {
+    paCache_.clear();
+    logger_->warn(DRT,
+                  158,
+                  "Cannot read pin access cache {}: {}.",
+                  PA_CACHE_FILE,
+                  e.what());
+  }
+}
+
+// Copies the cached access points of the instance class, moved to the
+// unique instance location. Returns false if the class is not cached.
+bool FlexPA::applyPACache(frInst* inst)
+{
+  auto keyIt = unique2CacheKey_.find(inst);
+  if (keyIt == unique2CacheKey_.end()) {
+    return false;
+  }
+  auto it = paCache_.find(keyIt->second);
+  if (it == paCache_.end()) {
+    return false;
+  }
+  const auto& pinAccesses = it->second;
+  int numPins = 0;
+  for (auto& instTerm : inst->getInstTerms()) {
+    numPins += instTerm->getTerm()->getPins().size();
+  }
+  if (numPins != (int) pinAccesses.size()) {
+    return false;
+  }
+
+  dbTransform xform(inst->getTransform().getOffset());
+  const int paIdx = unique2paidx_.at(inst);
+  int idx = 0;
+  for (auto& instTerm : inst->getInstTerms()) {
+    for (auto& pin : instTerm->getTerm()->getPins()) {
+      auto pinAccess = pin->getPinAccess(paIdx);
+      for (auto& ap : pinAccesses[idx]->getAccessPoints()) {
+        auto newAp = std::make_unique<frAccessPoint>(*ap);
+        Point pt(newAp->getPoint());
+        xform.apply(pt);
+        newAp->setPoint(pt);
+        for (auto& ps : newAp->getPathSegs()) {
+          Point begin = ps.getBeginPoint();
+          Point end = ps.getEndPoint();
+          xform.apply(begin);
+          xform.apply(end);
+          ps.setPoints(begin, end);
+        }
+        pinAccess->addAccessPoint(std::move(newAp));
+      }
+      idx++;
+    }
+  }
+  return true;
+}
+
+// Must be called after revertAccessPoints so the access points are relative
+// to the unique instance origin.
+void FlexPA::writePACache()
+{
+  ProfileTask profile("PA:writeCache");
+  for (auto& [inst, key] : unique2CacheKey_) {
+    const int paIdx = unique2paidx_[inst];
+    std::vector<std::unique_ptr<frPinAccess>> pinAccesses;
+    for (auto& instTerm : inst->getInstTerms()) {
+      for (auto& pin : instTerm->getTerm()->getPins()) {
+        pinAccesses.push_back(
+            std::make_unique<frPinAccess>(*pin->getPinAccess(paIdx)));
+      }
+    }
+    paCache_[key] = std::move(pinAccesses);
+  }
+
+  std::ofstream file(PA_CACHE_FILE, std::ios::binary);
+  if (!file.good()) {
+    logger_->warn(DRT, 159, "Cannot write pin access cache {}.", PA_CACHE_FILE);
+    return;
+  }
+  frOArchive ar(file);
+  registerTypes(ar);
+  std::size_t hash = getCacheHash();
+  ar << hash;
+  ar << paCache_;
+}
+
 void FlexPA::prep()
 {
   ProfileTask profile("PA:prep");
+  if (!PA_CACHE_FILE.empty()) {
+    readPACache();
+  }
   prepPoint();
   revertAccessPoints();
+  if (!PA_CACHE_FILE.empty()) {
+    writePACache();
+  }
   if (isDistributed()) {
     std::vector<paUpdate> updates;
     paUpdate update;
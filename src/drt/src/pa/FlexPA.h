@@ -121,6 +121,11 @@ class FlexPA
       frBlockObjectComp>
       masterOT2Insts;  // master orient track-offset to instances
   frCollection<odb::dbInst*> target_insts_;
+  // pin access cache, keyed by master, orient, track offsets and master
+  // geometry; each entry holds the pin accesses of all the pins of the
+  // instance (in inst term and pin order) relative to the instance origin
+  std::map<frInst*, std::string, frBlockObjectComp> unique2CacheKey_;
+  std::map<std::string, std::vector<std::unique_ptr<frPinAccess>>> paCache_;
 
   std::string remote_host_;
   ushort remote_port_;
@@ -130,6 +135,10 @@ class FlexPA
   // helper functions
   void setDesign(frDesign* in) { design_ = in; }
   void applyPatternsFile(const char* file_path);
+  std::size_t getCacheHash() const;
+  void readPACache();
+  bool applyPACache(frInst* inst);
+  void writePACache();
   void getPrefTrackPatterns(std::vector<frTrackPattern*>& prefTrackPatterns);
   bool hasTrackPattern(frTrackPattern* tp, const Rect& box);
   void getViaRawPriority(frViaDef* viaDef, viaRawPriorityTuple& priority);
@@ -1431,6 +1431,7 @@ void FlexPA::prepPoint()
 {
   ProfileTask profile("PA:point");
   int cnt = 0;
+  int cachedCnt = 0;
 
   omp_set_num_threads(MAX_THREADS);
   ThreadException exception;
@@ -1448,6 +1449,11 @@ void FlexPA::prepPoint()
           && masterType != dbMasterType::RING) {
         continue;
       }
+      if (applyPACache(inst)) {
+#pragma omp atomic
+        cachedCnt++;
+        continue;
+      }
       ProfileTask profile("PA:uniqueInstance");
       for (auto& instTerm : inst->getInstTerms()) {
         // only do for normal and clock terms
@@ -1486,6 +1492,13 @@ void FlexPA::prepPoint()
     }
   }
   exception.rethrow();
+  if (!PA_CACHE_FILE.empty() && VERBOSE > 0) {
+    logger_->info(DRT,
+                  151,
+                  "  Reused access points of {} unique instances from {}.",
+                  cachedCnt,
+                  PA_CACHE_FILE);
+  }
 
   // cout << "PA for IO terms\n" << flush;
 
@@ -120,7 +120,7 @@ int FlexTA::initTA_helper(int iter,
   auto& ygp = gCellPatterns.at(1);
   int sol = 0;
   numPanels = 0;
-  vector<vector<unique_ptr<FlexTAWorker>>> workers;
+  vector<unique_ptr<FlexTAWorker>> workers;
   if (isH) {
     for (int i = offset; i < (int) ygp.getCount(); i += size) {
       auto uworker
@@ -138,10 +138,7 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::HORIZONTAL);
       worker.setTAIter(iter);
-      if (workers.empty() || (int) workers.back().size() >= BATCHSIZETA) {
-        workers.push_back(vector<unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().push_back(std::move(uworker));
+      workers.push_back(std::move(uworker));
     }
   } else {
     for (int i = offset; i < (int) xgp.getCount(); i += size) {
@@ -160,41 +157,66 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::VERTICAL);
       worker.setTAIter(iter);
-      if (workers.empty() || (int) workers.back().size() >= BATCHSIZETA) {
-        workers.push_back(vector<unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().push_back(std::move(uworker));
+      workers.push_back(std::move(uworker));
     }
   }
 
-  omp_set_num_threads(min(8, MAX_THREADS));
-  // parallel execution
-  // multi thread
-  for (auto& workerBatch : workers) {
-    ProfileTask profile("TA:batch");
-    ThreadException exception;
-#pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < (int) workerBatch.size(); i++) {
-      try {
-        workerBatch[i]->main_mt();
-#pragma omp critical
-        {
-          sol += workerBatch[i]->getNumAssigned();
-          numPanels++;
+  // Alternate between the even and the odd panels. Panels of the same parity
+  // are not adjacent, so they don't see each other's iroutes and run
+  // concurrently; the odd panels then see the assignment of their even
+  // neighbors. The result doesn't depend on the number of threads.
+  vector<double> layerTimes(getTech()->getLayers().size(), 0.0);
+  const int batchSize = max(BATCHSIZETA, MAX_THREADS);
+  for (int parity = 0; parity < 2; parity++) {
+    vector<FlexTAWorker*> panels;
+    for (int i = parity; i < (int) workers.size(); i += 2) {
+      panels.push_back(workers[i].get());
+    }
+    for (int begin = 0; begin < (int) panels.size(); begin += batchSize) {
+      ProfileTask profile("TA:batch");
+      const int end = min(begin + batchSize, (int) panels.size());
+      ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(MAX_THREADS)
+      for (int i = begin; i < end; i++) {
+        try {
+          panels[i]->main_mt();
+        } catch (...) {
+          exception.capture();
         }
-      } catch (...) {
-        exception.capture();
+      }
+      exception.rethrow();
+      for (int i = begin; i < end; i++) {
+        sol += panels[i]->getNumAssigned();
+        numPanels++;
+        const auto& workerTimes = panels[i]->getLayerTimes();
+        for (int lNum = 0; lNum < (int) workerTimes.size(); lNum++) {
+          layerTimes[lNum] += workerTimes[lNum];
+        }
+        panels[i]->end();
+        workers[parity + 2 * i].reset();
       }
     }
-    exception.rethrow();
-    for (int i = 0; i < (int) workerBatch.size(); i++) {
-      workerBatch[i]->end();
-    }
-    workerBatch.clear();
   }
+  reportLayerTimes(layerTimes);
   return sol;
 }
 
+void FlexTA::reportLayerTimes(const vector<double>& layerTimes)
+{
+  for (int lNum = 0; lNum < (int) layerTimes.size(); lNum++) {
+    if (layerTimes[lNum] == 0.0) {
+      continue;
+    }
+    debugPrint(logger_,
+               DRT,
+               "ta",
+               1,
+               "Layer {} assign time {:.3f}s.",
+               getTech()->getLayer(lNum)->getName(),
+               layerTimes[lNum]);
+  }
+}
+
 void FlexTA::initTA(int size)
 {
   ProfileTask profile("TA:init");
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "db/obj/frVia.h"
 #include "db/taObj/taPin.h"
@@ -62,6 +63,7 @@ class FlexTA
   void initTA(int size);
   void searchRepair(int iter, int size, int offset);
   int initTA_helper(int iter, int size, int offset, bool isH, int& numPanels);
+  void reportLayerTimes(const std::vector<double>& layerTimes);
 };
 
 class FlexTAWorker;
@@ -177,6 +179,8 @@ class FlexTAWorker
   const FlexTAWorkerRegionQuery& getWorkerRegionQuery() const { return rq_; }
   FlexTAWorkerRegionQuery& getWorkerRegionQuery() { return rq_; }
   int getNumAssigned() const { return numAssigned_; }
+  // layer --> seconds spent assigning its iroutes
+  const std::vector<double>& getLayerTimes() const { return layerTimes_; }
   // others
   int main_mt();
 
@@ -196,6 +200,7 @@ class FlexTAWorker
   std::set<taPin*, taPinComp>
       reassignIroutes_;  // iroutes to be assigned in sorted order
   int numAssigned_;
+  std::vector<double> layerTimes_;
   int totCost_;
   int maxRetry_;
   bool hardIroutesMode;
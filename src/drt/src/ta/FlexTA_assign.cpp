@@ -26,6 +26,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <cmath>
 
 #include "ta/FlexTA.h"
@@ -1175,6 +1176,8 @@ void FlexTAWorker::assignIroute(taPin* iroute)
 
 void FlexTAWorker::assign()
 {
+  using namespace std::chrono;
+  layerTimes_.resize(getTech()->getLayers().size(), 0.0);
   int maxBufferSize = 20;
   vector<taPin*> buffers(maxBufferSize, nullptr);
   int currBufferIdx = 0;
@@ -1186,7 +1189,11 @@ void FlexTAWorker::assign()
       ;
       // not in the buffer, re-assign
     } else {
+      high_resolution_clock::time_point t0 = high_resolution_clock::now();
       assignIroute(iroute);
+      high_resolution_clock::time_point t1 = high_resolution_clock::now();
+      layerTimes_[iroute->getGuide()->getBeginLayerNum()]
+          += duration_cast<duration<double>>(t1 - t0).count();
       // re add last buffer item to reassigniroutes if drccost > 0
       // if (buffers[currBufferIdx]) {
       //  if (buffers[currBufferIdx]->getDrcCost()) {
@@ -0,0 +1,20 @@
+# Replays a worker dumped by gcd_nangate45_dump_worker.tcl several times to
+# time the maze search of a single worker. Run gcd_nangate45_dump_worker.tcl
+# first; it dumps the workers of iteration 2 to results. The worker replayed
+# is workerx155400_y67200 (as in gcd_nangate45_test_worker.tcl) unless
+# DRT_BENCH_WORKER names another worker directory in results.
+source "helpers.tcl"
+set worker_dir workerx155400_y67200
+if { [info exists ::env(DRT_BENCH_WORKER)] } {
+  set worker_dir $::env(DRT_BENCH_WORKER)
+}
+if { ![file isdirectory [file join results $worker_dir]] } {
+  error "results/$worker_dir not found, run gcd_nangate45_dump_worker.tcl first."
+}
+set_debug_level DRT autotuner 1
+detailed_route_debug -dr
+detailed_route_worker_debug -maze_end_iter 1 -drc_cost 8 -marker_cost 8 -follow_guide 1 -ripup_mode 1
+for {set i 0} {$i < 5} {incr i} {
+  detailed_route_run_worker -dump_dir results \
+                            -worker_dir $worker_dir
+}
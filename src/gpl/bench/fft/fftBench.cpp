@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2018-2020, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+// Times FFT::doFFT for every available backend on square bin grids from
+// 256x256 to 4096x4096 and reports the largest deviation of the
+// electrostatic potential from the Ooura reference.
+//
+// usage: gpl_fft_bench [threads] [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "fft.h"
+
+namespace {
+
+void fill(gpl::FFT& fft, int binCnt)
+{
+  std::mt19937 rng(binCnt);
+  std::uniform_real_distribution<float> dist(0.0f, 1.5f);
+  for (int x = 0; x < binCnt; x++) {
+    for (int y = 0; y < binCnt; y++) {
+      fft.updateDensity(x, y, dist(rng));
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const int threads = (argc > 1) ? std::atoi(argv[1]) : 1;
+  const int iterations = (argc > 2) ? std::atoi(argv[2]) : 5;
+
+  std::vector<gpl::FFTBackend> backends
+      = {gpl::FFTBackend::Ooura, gpl::FFTBackend::Threaded};
+  if (gpl::FFT::hasFFTW()) {
+    backends.push_back(gpl::FFTBackend::FFTW);
+  }
+
+  std::printf("threads %d, iterations %d\n", threads, iterations);
+  std::printf(
+      "%6s %-10s %12s %12s\n", "bins", "backend", "ms/iter", "max diff");
+
+  for (int binCnt = 256; binCnt <= 4096; binCnt *= 2) {
+    std::unique_ptr<gpl::FFT> reference;
+    for (gpl::FFTBackend backend : backends) {
+      auto fft = std::make_unique<gpl::FFT>(
+          binCnt, binCnt, 100, 100, backend, threads);
+
+      double seconds = 0;
+      for (int iter = 0; iter < iterations; iter++) {
+        // doFFT overwrites the density with its spectrum.
+        fill(*fft, binCnt);
+        auto start = std::chrono::steady_clock::now();
+        fft->doFFT();
+        auto end = std::chrono::steady_clock::now();
+        seconds += std::chrono::duration<double>(end - start).count();
+      }
+
+      float maxDiff = 0;
+      if (reference) {
+        for (int x = 0; x < binCnt; x++) {
+          for (int y = 0; y < binCnt; y++) {
+            maxDiff = std::max(maxDiff,
+                               std::fabs(fft->getElectroPhi(x, y)
+                                         - reference->getElectroPhi(x, y)));
+          }
+        }
+      } else {
+        reference = std::move(fft);
+      }
+
+      std::printf("%6d %-10s %12.3f %12g\n",
+                  binCnt,
+                  gpl::FFT::backendName(backend),
+                  1e3 * seconds / iterations,
+                  maxDiff);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,32 @@
+include(FindPackageHandleStandardArgs)
+
+if( CMAKE_FFTW_HOME )
+  set( FFTW_HOME ${CMAKE_FFTW_HOME} )
+elseif( DEFINED ENV{CMAKE_FFTW_HOME} )
+  set( FFTW_HOME $ENV{CMAKE_FFTW_HOME} )
+endif()
+
+find_path(FFTW_INCLUDE_DIRS fftw3.h
+  HINTS ${FFTW_HOME}
+  PATH_SUFFIXES include)
+
+# gpl only uses the single precision library.
+find_library(FFTW_LIBRARIES fftw3f
+  HINTS ${FFTW_HOME}
+  PATH_SUFFIXES lib lib64)
+
+find_package_handle_standard_args(
+    FFTW DEFAULT_MSG FFTW_LIBRARIES FFTW_INCLUDE_DIRS)
+
+if( FFTW_FOUND AND NOT TARGET FFTW::FFTW )
+  add_library(FFTW::FFTW UNKNOWN IMPORTED)
+  set_target_properties(FFTW::FFTW PROPERTIES
+    IMPORTED_LOCATION "${FFTW_LIBRARIES}"
+    INTERFACE_INCLUDE_DIRECTORIES "${FFTW_INCLUDE_DIRS}"
+  )
+
+  mark_as_advanced(
+    FFTW_INCLUDE_DIRS
+    FFTW_LIBRARIES
+  )
+endif()
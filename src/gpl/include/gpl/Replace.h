@@ -34,6 +34,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace odb {
@@ -127,12 +128,21 @@ class Replace
   void setRoutabilityTargetRcMetric(float rc);
   void setRoutabilityInflationRatioCoef(float ratio);
   void setRoutabilityMaxInflationRatio(float ratio);
+  void setRoutabilityMoveThreshold(float threshold);
 
   void setRoutabilityRcCoefficients(float k1, float k2, float k3, float k4);
 
   void addTimingNetWeightOverflow(int overflow);
   void setTimingNetWeightMax(float max);
 
+  // Number of threads used by the Nesterov gradient/density passes.
+  void setNumThreads(int threads);
+  // Density FFT implementation: "ooura", "threaded" or "fftw".
+  void setFftBackend(const std::string& backend);
+  // Initial place CPU solver: "bicgstab", "cg" (Jacobi preconditioned)
+  // or "cg_ic" (incomplete Cholesky preconditioned).
+  void setInitialPlaceSolver(const std::string& solver);
+
   void setDebug(int pause_iterations,
                 int update_iterations,
                 bool draw_bins,
@@ -178,6 +188,7 @@ class Replace
   float routabilityTargetRcMetric_;
   float routabilityInflationRatioCoef_;
   float routabilityMaxInflationRatio_;
+  float routabilityMoveThreshold_;
 
   // routability RC metric coefficients
   float routabilityRcK1_, routabilityRcK2_, routabilityRcK3_, routabilityRcK4_;
@@ -198,6 +209,10 @@ class Replace
   int padLeft_;
   int padRight_;
 
+  int numThreads_;
+  std::string fftBackend_;
+  std::string initialPlaceSolver_;
+
   bool gui_debug_;
   int gui_debug_pause_iterations_;
   int gui_debug_update_iterations_;
@@ -33,15 +33,290 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
 
+#ifdef HAS_FFTW
+#include <fftw3.h>
+#endif
+
 #define REPLACE_FFT_PI 3.141592653589793238462L
 
 namespace gpl {
 
+// Real-to-real 2D transforms on a binCntX x binCntY array (a[x][y]).
+// Every backend must produce the same values as the fftsg2d routine
+// named in the comment (up to floating point rounding).
+class DCTBackend
+{
+ public:
+  virtual ~DCTBackend() = default;
+
+  // ddct2d(isgn = -1)
+  virtual void forwardCos(float** a) = 0;
+  // ddct2d(isgn = 1)
+  virtual void inverseCos(float** a) = 0;
+  // ddsct2d(isgn = 1); sin along x, cos along y
+  virtual void inverseSinCos(float** a) = 0;
+  // ddcst2d(isgn = 1); cos along x, sin along y
+  virtual void inverseCosSin(float** a) = 0;
+};
+
+namespace {
+
+class OouraBackend : public DCTBackend
+{
+ public:
+  OouraBackend(int n1, int n2);
+
+  void forwardCos(float** a) override
+  {
+    ddct2d(n1_, n2_, -1, a, t_.data(), ip_.data(), w_.data());
+  }
+  void inverseCos(float** a) override
+  {
+    ddct2d(n1_, n2_, 1, a, t_.data(), ip_.data(), w_.data());
+  }
+  void inverseSinCos(float** a) override
+  {
+    ddsct2d(n1_, n2_, 1, a, t_.data(), ip_.data(), w_.data());
+  }
+  void inverseCosSin(float** a) override
+  {
+    ddcst2d(n1_, n2_, 1, a, t_.data(), ip_.data(), w_.data());
+  }
+
+ protected:
+  int n1_;
+  int n2_;
+
+  // cos/sin table (prev: w_2d)
+  // length:  max(n1, n2) * 3 / 2
+  std::vector<float> w_;
+
+  // work area for bit reversal (prev: ip)
+  // length: round(sqrt( max(n1, n2) )) + 2
+  std::vector<int> ip_;
+
+  // column work area of ddxt2d_sub; length: 4 * n1
+  std::vector<float> t_;
+};
+
+OouraBackend::OouraBackend(int n1, int n2) : n1_(n1), n2_(n2)
+{
+  const int n = std::max(n1_, n2_);
+  w_.resize(n * 3 / 2, 0);
+  ip_.resize(round(sqrt(n)) + 2, 0);
+  t_.resize(4 * n1_, 0);
+}
+
+// Splits the 2D transform into independent 1D fftsg transforms: first
+// along y (rows are contiguous), then along x. The x pass gathers
+// kColumnBlock columns at a time into a per-thread buffer so each row
+// access reads a whole cache line instead of the 4 floats ddxt2d_sub
+// uses. The 1D calls are the same as in fftsg2d, so the results are
+// bit-identical to OouraBackend for any thread count.
+class ThreadedBackend : public OouraBackend
+{
+ public:
+  ThreadedBackend(int n1, int n2, int numThreads);
+
+  void forwardCos(float** a) override { transform(a, -1, false, false); }
+  void inverseCos(float** a) override { transform(a, 1, false, false); }
+  void inverseSinCos(float** a) override { transform(a, 1, true, false); }
+  void inverseCosSin(float** a) override { transform(a, 1, false, true); }
+
+ private:
+  static constexpr int kColumnBlock = 16;
+
+  void transform(float** a, int isgn, bool sinX, bool sinY);
+
+  int numThreads_;
+  // per-thread column buffers; length: kColumnBlock * n1
+  std::vector<std::vector<float>> work_;
+};
+
+ThreadedBackend::ThreadedBackend(int n1, int n2, int numThreads)
+    : OouraBackend(n1, n2), numThreads_(numThreads)
+{
+  // fftsg fills the tables lazily on the first call. Do it here so the
+  // threads below only ever read them.
+  const int n = std::max(n1_, n2_);
+  int nw = ip_[0];
+  if (n > (nw << 2)) {
+    nw = n >> 2;
+    makewt(nw, ip_.data(), w_.data());
+  }
+  int nc = ip_[1];
+  if (n > nc) {
+    nc = n;
+    makect(nc, ip_.data(), w_.data() + nw);
+  }
+
+  work_.resize(numThreads_);
+  for (auto& work : work_) {
+    work.resize(kColumnBlock * n1_, 0);
+  }
+}
+
+void ThreadedBackend::transform(float** a, int isgn, bool sinX, bool sinY)
+{
+  int* ip = ip_.data();
+  float* w = w_.data();
+
+#pragma omp parallel for num_threads(numThreads_)
+  for (int i = 0; i < n1_; i++) {
+    if (sinY) {
+      ddst(n2_, isgn, a[i], ip, w);
+    } else {
+      ddct(n2_, isgn, a[i], ip, w);
+    }
+  }
+
+  const int blockCnt = (n2_ + kColumnBlock - 1) / kColumnBlock;
+#pragma omp parallel for num_threads(numThreads_)
+  for (int b = 0; b < blockCnt; b++) {
+    float* t = work_[omp_get_thread_num()].data();
+    const int j0 = b * kColumnBlock;
+    const int cnt = std::min(kColumnBlock, n2_ - j0);
+
+    for (int i = 0; i < n1_; i++) {
+      const float* row = a[i] + j0;
+      for (int c = 0; c < cnt; c++) {
+        t[c * n1_ + i] = row[c];
+      }
+    }
+
+    for (int c = 0; c < cnt; c++) {
+      if (sinX) {
+        ddst(n1_, isgn, &t[c * n1_], ip, w);
+      } else {
+        ddct(n1_, isgn, &t[c * n1_], ip, w);
+      }
+    }
+
+    for (int i = 0; i < n1_; i++) {
+      float* row = a[i] + j0;
+      for (int c = 0; c < cnt; c++) {
+        row[c] = t[c * n1_ + i];
+      }
+    }
+  }
+}
+
+#ifdef HAS_FFTW
+// fftsg conventions expressed with FFTW r2r kinds (per dimension):
+//   ddct(-1) = REDFT10 / 2
+//   ddct(1)  = REDFT01 / 2, with a[0] doubled
+//   ddst(1)  = RODFT01 / 2, with the input rotated by one (fftsg keeps
+//              the a[n] term in a[0]) and that term doubled
+class FFTWBackend : public DCTBackend
+{
+ public:
+  FFTWBackend(int n1, int n2, int numThreads);
+  ~FFTWBackend() override;
+
+  void forwardCos(float** a) override
+  {
+    execute(forwardCos_, a, false, false, false);
+  }
+  void inverseCos(float** a) override
+  {
+    execute(inverseCos_, a, true, false, false);
+  }
+  void inverseSinCos(float** a) override
+  {
+    execute(inverseSinCos_, a, true, true, false);
+  }
+  void inverseCosSin(float** a) override
+  {
+    execute(inverseCosSin_, a, true, false, true);
+  }
+
+ private:
+  void execute(fftwf_plan plan, float** a, bool inverse, bool sinX, bool sinY);
+
+  int n1_;
+  int n2_;
+  int numThreads_;
+  float* buf_;
+  fftwf_plan forwardCos_;
+  fftwf_plan inverseCos_;
+  fftwf_plan inverseSinCos_;
+  fftwf_plan inverseCosSin_;
+};
+
+FFTWBackend::FFTWBackend(int n1, int n2, int numThreads)
+    : n1_(n1), n2_(n2), numThreads_(numThreads)
+{
+  buf_ = fftwf_alloc_real(static_cast<size_t>(n1_) * n2_);
+  forwardCos_ = fftwf_plan_r2r_2d(
+      n1_, n2_, buf_, buf_, FFTW_REDFT10, FFTW_REDFT10, FFTW_MEASURE);
+  inverseCos_ = fftwf_plan_r2r_2d(
+      n1_, n2_, buf_, buf_, FFTW_REDFT01, FFTW_REDFT01, FFTW_MEASURE);
+  inverseSinCos_ = fftwf_plan_r2r_2d(
+      n1_, n2_, buf_, buf_, FFTW_RODFT01, FFTW_REDFT01, FFTW_MEASURE);
+  inverseCosSin_ = fftwf_plan_r2r_2d(
+      n1_, n2_, buf_, buf_, FFTW_REDFT01, FFTW_RODFT01, FFTW_MEASURE);
+}
+
+FFTWBackend::~FFTWBackend()
+{
+  fftwf_destroy_plan(forwardCos_);
+  fftwf_destroy_plan(inverseCos_);
+  fftwf_destroy_plan(inverseSinCos_);
+  fftwf_destroy_plan(inverseCosSin_);
+  fftwf_free(buf_);
+}
+
+void FFTWBackend::execute(fftwf_plan plan,
+                          float** a,
+                          bool inverse,
+                          bool sinX,
+                          bool sinY)
+{
+  const int shiftX = sinX ? 1 : 0;
+  const int shiftY = sinY ? 1 : 0;
+
+#pragma omp parallel for num_threads(numThreads_)
+  for (int p = 0; p < n1_; p++) {
+    const int i = (p + shiftX) % n1_;
+    const float* src = a[i];
+    float* dst = buf_ + static_cast<size_t>(p) * n2_;
+    std::copy(src + shiftY, src + n2_, dst);
+    if (shiftY) {
+      dst[n2_ - 1] = src[0];
+    }
+    if (inverse) {
+      dst[shiftY ? n2_ - 1 : 0] *= 2.0f;
+      if (i == 0) {
+        for (int q = 0; q < n2_; q++) {
+          dst[q] *= 2.0f;
+        }
+      }
+    }
+  }
+
+  fftwf_execute(plan);
+
+#pragma omp parallel for num_threads(numThreads_)
+  for (int i = 0; i < n1_; i++) {
+    const float* src = buf_ + static_cast<size_t>(i) * n2_;
+    float* dst = a[i];
+    for (int j = 0; j < n2_; j++) {
+      dst[j] = 0.25f * src[j];
+    }
+  }
+}
+#endif
+
+}  // namespace
+
 FFT::FFT()
     : binDensity_(nullptr),
       electroPhi_(nullptr),
@@ -50,70 +325,56 @@ FFT::FFT()
       binCntX_(0),
       binCntY_(0),
       binSizeX_(0),
-      binSizeY_(0)
+      binSizeY_(0),
+      numThreads_(1)
 {
 }
 
-FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
+FFT::FFT(int binCntX,
+         int binCntY,
+         int binSizeX,
+         int binSizeY,
+         FFTBackend backend,
+         int numThreads)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
-      binSizeY_(binSizeY)
+      binSizeY_(binSizeY),
+      numThreads_(std::max(numThreads, 1))
 {
-  init();
+  init(backend);
 }
 
 FFT::~FFT()
 {
-  using std::vector;
-  for (int i = 0; i < binCntX_; i++) {
-    delete[] binDensity_[i];
-    delete[] electroPhi_[i];
-    delete[] electroForceX_[i];
-    delete[] electroForceY_[i];
-  }
   delete[] binDensity_;
   delete[] electroPhi_;
   delete[] electroForceX_;
   delete[] electroForceY_;
-
-  csTable_.clear();
-  wx_.clear();
-  wxSquare_.clear();
-  wy_.clear();
-  wySquare_.clear();
-
-  workArea_.clear();
 }
 
-void FFT::init()
+void FFT::init(FFTBackend backend)
 {
   binDensity_ = new float*[binCntX_];
   electroPhi_ = new float*[binCntX_];
   electroForceX_ = new float*[binCntX_];
   electroForceY_ = new float*[binCntX_];
 
+  const size_t binCnt = static_cast<size_t>(binCntX_) * binCntY_;
+  storage_.resize(4 * binCnt, 0.0f);
   for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i] = new float[binCntY_];
-    electroPhi_[i] = new float[binCntY_];
-    electroForceX_[i] = new float[binCntY_];
-    electroForceY_[i] = new float[binCntY_];
-
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] = electroPhi_[i][j] = electroForceX_[i][j]
-          = electroForceY_[i][j] = 0.0f;
-    }
+    const size_t offset = static_cast<size_t>(i) * binCntY_;
+    binDensity_[i] = &storage_[offset];
+    electroPhi_[i] = &storage_[binCnt + offset];
+    electroForceX_[i] = &storage_[2 * binCnt + offset];
+    electroForceY_[i] = &storage_[3 * binCnt + offset];
   }
 
-  csTable_.resize(std::max(binCntX_, binCntY_) * 3 / 2, 0);
-
   wx_.resize(binCntX_, 0);
   wxSquare_.resize(binCntX_, 0);
   wy_.resize(binCntY_, 0);
   wySquare_.resize(binCntY_, 0);
 
-  workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
-
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -126,6 +387,61 @@ void FFT::init()
              / static_cast<float>(binSizeX_);
     wySquare_[i] = wy_[i] * wy_[i];
   }
+
+  switch (backend) {
+    case FFTBackend::Ooura:
+      backend_ = std::make_unique<OouraBackend>(binCntX_, binCntY_);
+      break;
+    case FFTBackend::Threaded:
+      backend_ = std::make_unique<ThreadedBackend>(
+          binCntX_, binCntY_, numThreads_);
+      break;
+    case FFTBackend::FFTW:
+#ifdef HAS_FFTW
+      backend_
+          = std::make_unique<FFTWBackend>(binCntX_, binCntY_, numThreads_);
+#else
+      // callers are expected to check hasFFTW(); keep going with the
+      // equivalent threaded transforms.
+      backend_ = std::make_unique<ThreadedBackend>(
+          binCntX_, binCntY_, numThreads_);
+#endif
+      break;
+  }
+}
+
+bool FFT::parseBackend(const std::string& name, FFTBackend& backend)
+{
+  for (FFTBackend candidate :
+       {FFTBackend::Ooura, FFTBackend::Threaded, FFTBackend::FFTW}) {
+    if (name == backendName(candidate)) {
+      backend = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* FFT::backendName(FFTBackend backend)
+{
+  switch (backend) {
+    case FFTBackend::Ooura:
+      return "ooura";
+    case FFTBackend::Threaded:
+      return "threaded";
+    case FFTBackend::FFTW:
+      return "fftw";
+  }
+  return "unknown";
+}
+
+bool FFT::hasFFTW()
+{
+#ifdef HAS_FFTW
+  return true;
+#else
+  return false;
+#endif
 }
 
 void FFT::updateDensity(int x, int y, float density)
@@ -147,85 +463,58 @@ using namespace std;
 
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         NULL,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i][0] *= 0.5;
-  }
-
-  for (int i = 0; i < binCntY_; i++) {
-    binDensity_[0][i] *= 0.5;
-  }
+  backend_->forwardCos(binDensity_);
 
-  for (int i = 0; i < binCntX_; i++) {
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
-    }
-  }
+  const double scale = 4.0 / binCntX_ / binCntY_;
 
+#pragma omp parallel for num_threads(numThreads_)
   for (int i = 0; i < binCntX_; i++) {
+    float* density = binDensity_[i];
+    float* electroPhi = electroPhi_[i];
+    float* electroForceX = electroForceX_[i];
+    float* electroForceY = electroForceY_[i];
     float wx = wx_[i];
     float wx2 = wxSquare_[i];
 
-    for (int j = 0; j < binCntY_; j++) {
-      float wy = wy_[j];
-      float wy2 = wySquare_[j];
+    density[0] *= 0.5;
+    if (i == 0) {
+      for (int j = 0; j < binCntY_; j++) {
+        density[j] *= 0.5;
+      }
+    }
 
-      float density = binDensity_[i][j];
-      float phi = 0;
-      float electroX = 0, electroY = 0;
+    for (int j = 0; j < binCntY_; j++) {
+      density[j] *= scale;
+    }
 
-      if (i == 0 && j == 0) {
-        phi = electroX = electroY = 0.0f;
-      } else {
-        //////////// lutong
-        //  denom =
-        //  wx2 / 4.0 +
-        //  wy2 / 4.0 ;
-        // a_phi = a_den / denom ;
-        ////b_phi = 0 ; // -1.0 * b / denom ;
-        ////a_ex = 0 ; // b_phi * wx ;
-        // a_ex = a_phi * wx / 2.0 ;
-        ////a_ey = 0 ; // b_phi * wy ;
-        // a_ey = a_phi * wy / 2.0 ;
-        ///////////
-        phi = density / (wx2 + wy2);
-        electroX = phi * wx;
-        electroY = phi * wy;
-      }
-      electroPhi_[i][j] = phi;
-      electroForceX_[i][j] = electroX;
-      electroForceY_[i][j] = electroY;
+    //////////// lutong
+    //  denom =
+    //  wx2 / 4.0 +
+    //  wy2 / 4.0 ;
+    // a_phi = a_den / denom ;
+    ////b_phi = 0 ; // -1.0 * b / denom ;
+    ////a_ex = 0 ; // b_phi * wx ;
+    // a_ex = a_phi * wx / 2.0 ;
+    ////a_ey = 0 ; // b_phi * wy ;
+    // a_ey = a_phi * wy / 2.0 ;
+    ///////////
+    // The (0, 0) term has no potential (and would divide by zero).
+    const int jBegin = (i == 0) ? 1 : 0;
+    if (i == 0) {
+      electroPhi[0] = electroForceX[0] = electroForceY[0] = 0.0f;
+    }
+    for (int j = jBegin; j < binCntY_; j++) {
+      float phi = density[j] / (wx2 + wySquare_[j]);
+      electroPhi[j] = phi;
+      electroForceX[j] = phi * wx;
+      electroForceY[j] = phi * wy_[j];
     }
   }
+
   // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         NULL,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          NULL,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          NULL,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
+  backend_->inverseCos(electroPhi_);
+  backend_->inverseSinCos(electroForceX_);
+  backend_->inverseCosSin(electroForceY_);
 }
 
 }  // namespace gpl
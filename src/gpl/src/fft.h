@@ -33,15 +33,33 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace gpl {
 
+// Implementations of the real-to-real 2D transforms used by the
+// electrostatic solver. All of them follow the fftsg2d conventions.
+enum class FFTBackend
+{
+  Ooura,     // reference fftsg2d routines, single threaded
+  Threaded,  // cache-blocked rows/columns transforms using OpenMP
+  FFTW       // FFTW3 r2r plans, only available when built with FFTW
+};
+
+class DCTBackend;
+
 class FFT
 {
  public:
   FFT();
-  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
+  FFT(int binCntX,
+      int binCntY,
+      int binSizeX,
+      int binSizeY,
+      FFTBackend backend = FFTBackend::Threaded,
+      int numThreads = 1);
   ~FFT();
 
   // input func
@@ -54,17 +72,20 @@ class FFT
   std::pair<float, float> getElectroForce(int x, int y) const;
   float getElectroPhi(int x, int y) const;
 
+  // backend name <-> enum; returns false for unknown names.
+  static bool parseBackend(const std::string& name, FFTBackend& backend);
+  static const char* backendName(FFTBackend backend);
+  static bool hasFFTW();
+
  private:
   // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
+  // Each array is a single contiguous binCntX_ * binCntY_ block
+  // with row pointers into it, as expected by the fftsg2d routines.
   float** binDensity_;
   float** electroPhi_;
   float** electroForceX_;
   float** electroForceY_;
-
-  // cos/sin table (prev: w_2d)
-  // length:  max(binCntX, binCntY) * 3 / 2
-  std::vector<float> csTable_;
+  std::vector<float> storage_;
 
   // wx. length:  binCntX_
   std::vector<float> wx_;
@@ -74,16 +95,15 @@ class FFT
   std::vector<float> wy_;
   std::vector<float> wySquare_;
 
-  // work area for bit reversal (prev: ip)
-  // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
-  std::vector<int> workArea_;
+  std::unique_ptr<DCTBackend> backend_;
 
   int binCntX_;
   int binCntY_;
   int binSizeX_;
   int binSizeY_;
+  int numThreads_;
 
-  void init();
+  void init(FFTBackend backend);
 };
 
 //
@@ -95,6 +115,8 @@ class FFT
 void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
+void makewt(int nw, int* ip, float* w);
+void makect(int nc, int* ip, float* c);
 
 /// 2D FFT ////////////////////////////////////////////////////////////////
 void cdft2d(int, int, int, float**, float*, int*, float*);
@@ -33,6 +33,8 @@
 
 #include "initialPlace.h"
 
+#include <algorithm>
+
 #include "placerBase.h"
 #include "solver.h"
 
@@ -55,6 +57,8 @@ void InitialPlaceVars::reset()
   netWeightScale = 800.0;
   debug = false;
   forceCPU = false;
+  numThreads = 1;
+  solver = InitialPlaceSolver::BiCGSTAB;
 }
 
 InitialPlace::InitialPlace() : ipVars_(), pb_(nullptr), log_(nullptr)
@@ -120,7 +124,9 @@ void InitialPlace::doBicgstabPlace()
     if (run_cpu) {
       if (ipVars_.forceCPU)
         log_->warn(GPL, 251, "CPU solver is forced to be used.");
-      error = cpuSparseSolve(ipVars_.maxSolverIter,
+      error = cpuSparseSolve(ipVars_.solver,
+                             ipVars_.numThreads,
+                             ipVars_.maxSolverIter,
                              iter,
                              placeInstForceMatrixX_,
                              fixedInstForceVecX_,
@@ -252,11 +258,8 @@ void InitialPlace::createSparseMatrix()
   // to fill in SparseMatrix from Eigen docs.
   //
 
-  vector<T> listX, listY;
-  listX.reserve(1000000);
-  listY.reserve(1000000);
-
-  // initialize vector
+  // initialize vector. The solver starts from the current locations, i.e.
+  // the previous iteration's solution as written back by updateCoordi().
   for (auto& inst : pb_->placeInsts()) {
     int idx = inst->extId();
 
@@ -266,152 +269,201 @@ void InitialPlace::createSparseMatrix()
     fixedInstForceVecX_(idx) = fixedInstForceVecY_(idx) = 0;
   }
 
-  // for each net
-  for (auto& net : pb_->nets()) {
-    // skip for small nets.
-    if (net->pins().size() <= 1) {
-      continue;
+  // Nets are split into contiguous chunks filled in parallel. Merging
+  // them in chunk order gives the same triplet/force order (and so the
+  // same sums) as a sequential pass over the nets.
+  const auto& nets = pb_->nets();
+  const int chunkCnt
+      = std::max(1, std::min<int>(4 * ipVars_.numThreads, nets.size()));
+  chunks_.resize(chunkCnt);
+
+#pragma omp parallel for num_threads(ipVars_.numThreads) schedule(dynamic)
+  for (int c = 0; c < chunkCnt; c++) {
+    MatrixChunk& chunk = chunks_[c];
+    chunk.listX.clear();
+    chunk.listY.clear();
+    chunk.forceX.clear();
+    chunk.forceY.clear();
+
+    const size_t begin = nets.size() * c / chunkCnt;
+    const size_t end = nets.size() * (c + 1) / chunkCnt;
+    for (size_t i = begin; i < end; i++) {
+      addNetEntries(nets[i], chunk);
     }
+  }
 
-    // escape long time cals on huge fanout.
-    //
-    if (net->pins().size() >= ipVars_.maxFanout) {
-      continue;
+  size_t listXSize = 0, listYSize = 0;
+  for (const MatrixChunk& chunk : chunks_) {
+    listXSize += chunk.listX.size();
+    listYSize += chunk.listY.size();
+  }
+
+  vector<T> listX, listY;
+  listX.reserve(listXSize);
+  listY.reserve(listYSize);
+
+  for (const MatrixChunk& chunk : chunks_) {
+    listX.insert(listX.end(), chunk.listX.begin(), chunk.listX.end());
+    listY.insert(listY.end(), chunk.listY.begin(), chunk.listY.end());
+    for (const auto& [idx, force] : chunk.forceX) {
+      fixedInstForceVecX_(idx) += force;
+    }
+    for (const auto& [idx, force] : chunk.forceY) {
+      fixedInstForceVecY_(idx) += force;
     }
+  }
+
+  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
+  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+}
+
+// B2B entries of a single net.
+void InitialPlace::addNetEntries(Net* net, MatrixChunk& chunk) const
+{
+  // skip for small nets.
+  if (net->pins().size() <= 1) {
+    return;
+  }
+
+  // escape long time cals on huge fanout.
+  //
+  if (net->pins().size() >= ipVars_.maxFanout) {
+    return;
+  }
 
-    float netWeight = ipVars_.netWeightScale / (net->pins().size() - 1);
-    // cout << "net: " << net.net()->getConstName() << endl;
+  float netWeight = ipVars_.netWeightScale / (net->pins().size() - 1);
+  // cout << "net: " << net.net()->getConstName() << endl;
 
-    // foreach two pins in single nets.
-    auto& pins = net->pins();
-    for (int pinIdx1 = 1; pinIdx1 < pins.size(); ++pinIdx1) {
-      Pin* pin1 = pins[pinIdx1];
-      for (int pinIdx2 = 0; pinIdx2 < pinIdx1; ++pinIdx2) {
-        Pin* pin2 = pins[pinIdx2];
+  // foreach two pins in single nets.
+  auto& pins = net->pins();
+  for (int pinIdx1 = 1; pinIdx1 < pins.size(); ++pinIdx1) {
+    Pin* pin1 = pins[pinIdx1];
+    for (int pinIdx2 = 0; pinIdx2 < pinIdx1; ++pinIdx2) {
+      Pin* pin2 = pins[pinIdx2];
 
-        // no need to fill in when instance is same
-        if (pin1->instance() == pin2->instance()) {
-          continue;
+      // no need to fill in when instance is same
+      if (pin1->instance() == pin2->instance()) {
+        continue;
+      }
+
+      // B2B modeling on min/maxX pins.
+      if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
+          || pin2->isMaxPinX()) {
+        int diffX = abs(pin1->cx() - pin2->cx());
+        float weightX = 0;
+        if (diffX > ipVars_.minDiffLength) {
+          weightX = netWeight / diffX;
+        } else {
+          weightX = netWeight / ipVars_.minDiffLength;
         }
 
-        // B2B modeling on min/maxX pins.
-        if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
-            || pin2->isMaxPinX()) {
-          int diffX = abs(pin1->cx() - pin2->cx());
-          float weightX = 0;
-          if (diffX > ipVars_.minDiffLength) {
-            weightX = netWeight / diffX;
-          } else {
-            weightX = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-            // cout << "inst: " << inst1 << " " << inst2 << endl;
-
-            listX.push_back(T(inst1, inst1, weightX));
-            listX.push_back(T(inst2, inst2, weightX));
-
-            listX.push_back(T(inst1, inst2, -weightX));
-            listX.push_back(T(inst2, inst1, -weightX));
-
-            // cout << pin1->cx() << " "
-            //  << pin1->instance()->cx() << endl;
-            fixedInstForceVecX_(inst1)
-                += -weightX
-                   * ((pin1->cx() - pin1->instance()->cx())
-                      - (pin2->cx() - pin2->instance()->cx()));
-
-            fixedInstForceVecX_(inst2)
-                += -weightX
-                   * ((pin2->cx() - pin2->instance()->cx())
-                      - (pin1->cx() - pin1->instance()->cx()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            // cout << "inst2: " << inst2 << endl;
-            listX.push_back(T(inst2, inst2, weightX));
-
-            fixedInstForceVecX_(inst2)
-                += weightX
-                   * (pin1->cx() - (pin2->cx() - pin2->instance()->cx()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            // cout << "inst1: " << inst1 << endl;
-            listX.push_back(T(inst1, inst1, weightX));
-
-            fixedInstForceVecX_(inst1)
-                += weightX
-                   * (pin2->cx() - (pin1->cx() - pin1->instance()->cx()));
-          }
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
+          // cout << "inst: " << inst1 << " " << inst2 << endl;
+
+          chunk.listX.push_back(T(inst1, inst1, weightX));
+          chunk.listX.push_back(T(inst2, inst2, weightX));
+
+          chunk.listX.push_back(T(inst1, inst2, -weightX));
+          chunk.listX.push_back(T(inst2, inst1, -weightX));
+
+          // cout << pin1->cx() << " "
+          //  << pin1->instance()->cx() << endl;
+          chunk.forceX.emplace_back(
+              inst1,
+              -weightX
+                  * ((pin1->cx() - pin1->instance()->cx())
+                     - (pin2->cx() - pin2->instance()->cx())));
+
+          chunk.forceX.emplace_back(
+              inst2,
+              -weightX
+                  * ((pin2->cx() - pin2->instance()->cx())
+                     - (pin1->cx() - pin1->instance()->cx())));
+        }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          // cout << "inst2: " << inst2 << endl;
+          chunk.listX.push_back(T(inst2, inst2, weightX));
+
+          chunk.forceX.emplace_back(
+              inst2,
+              weightX * (pin1->cx() - (pin2->cx() - pin2->instance()->cx())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          // cout << "inst1: " << inst1 << endl;
+          chunk.listX.push_back(T(inst1, inst1, weightX));
+
+          chunk.forceX.emplace_back(
+              inst1,
+              weightX * (pin2->cx() - (pin1->cx() - pin1->instance()->cx())));
+        }
+      }
+
+      // B2B modeling on min/maxY pins.
+      if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
+          || pin2->isMaxPinY()) {
+        int diffY = abs(pin1->cy() - pin2->cy());
+        float weightY = 0;
+        if (diffY > ipVars_.minDiffLength) {
+          weightY = netWeight / diffY;
+        } else {
+          weightY = netWeight / ipVars_.minDiffLength;
         }
 
-        // B2B modeling on min/maxY pins.
-        if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
-            || pin2->isMaxPinY()) {
-          int diffY = abs(pin1->cy() - pin2->cy());
-          float weightY = 0;
-          if (diffY > ipVars_.minDiffLength) {
-            weightY = netWeight / diffY;
-          } else {
-            weightY = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-
-            listY.push_back(T(inst1, inst1, weightY));
-            listY.push_back(T(inst2, inst2, weightY));
-
-            listY.push_back(T(inst1, inst2, -weightY));
-            listY.push_back(T(inst2, inst1, -weightY));
-
-            fixedInstForceVecY_(inst1)
-                += -weightY
-                   * ((pin1->cy() - pin1->instance()->cy())
-                      - (pin2->cy() - pin2->instance()->cy()));
-
-            fixedInstForceVecY_(inst2)
-                += -weightY
-                   * ((pin2->cy() - pin2->instance()->cy())
-                      - (pin1->cy() - pin1->instance()->cy()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            listY.push_back(T(inst2, inst2, weightY));
-
-            fixedInstForceVecY_(inst2)
-                += weightY
-                   * (pin1->cy() - (pin2->cy() - pin2->instance()->cy()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            listY.push_back(T(inst1, inst1, weightY));
-
-            fixedInstForceVecY_(inst1)
-                += weightY
-                   * (pin2->cy() - (pin1->cy() - pin1->instance()->cy()));
-          }
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
+
+          chunk.listY.push_back(T(inst1, inst1, weightY));
+          chunk.listY.push_back(T(inst2, inst2, weightY));
+
+          chunk.listY.push_back(T(inst1, inst2, -weightY));
+          chunk.listY.push_back(T(inst2, inst1, -weightY));
+
+          chunk.forceY.emplace_back(
+              inst1,
+              -weightY
+                  * ((pin1->cy() - pin1->instance()->cy())
+                     - (pin2->cy() - pin2->instance()->cy())));
+
+          chunk.forceY.emplace_back(
+              inst2,
+              -weightY
+                  * ((pin2->cy() - pin2->instance()->cy())
+                     - (pin1->cy() - pin1->instance()->cy())));
+        }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          chunk.listY.push_back(T(inst2, inst2, weightY));
+
+          chunk.forceY.emplace_back(
+              inst2,
+              weightY * (pin1->cy() - (pin2->cy() - pin2->instance()->cy())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          chunk.listY.push_back(T(inst1, inst1, weightY));
+
+          chunk.forceY.emplace_back(
+              inst1,
+              weightY * (pin2->cy() - (pin1->cy() - pin1->instance()->cy())));
         }
       }
     }
   }
-
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
 }
 
 void InitialPlace::updateCoordi()
@@ -35,6 +35,8 @@
 
 #include <Eigen/SparseCore>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "nesterovPlace.h"
 #include "odb/db.h"
@@ -47,6 +49,16 @@ namespace gpl {
 
 class PlacerBase;
 class Graphics;
+class Net;
+
+// Iterative method of the CPU solver. The B2B matrices are symmetric,
+// so conjugate gradient can be used in place of BiCGSTAB.
+enum class InitialPlaceSolver
+{
+  BiCGSTAB,                  // BiCGSTAB, no preconditioner
+  ConjugateGradient,         // CG with Jacobi (diagonal) preconditioner
+  ConjugateGradientCholesky  // CG with incomplete Cholesky preconditioner
+};
 
 class InitialPlaceVars
 {
@@ -58,6 +70,8 @@ class InitialPlaceVars
   float netWeightScale;
   bool debug;
   bool forceCPU;
+  int numThreads;
+  InitialPlaceSolver solver;
 
   InitialPlaceVars();
   void reset();
@@ -110,10 +124,21 @@ class InitialPlace
   Eigen::VectorXf instLocVecY_, fixedInstForceVecY_;
   SMatrix placeInstForceMatrixX_, placeInstForceMatrixY_;
 
+  // Per-chunk matrix entries and force contributions filled in parallel
+  // by createSparseMatrix. They are merged in chunk (= net) order so the
+  // matrices do not depend on the thread count.
+  struct MatrixChunk
+  {
+    std::vector<Eigen::Triplet<float>> listX, listY;
+    std::vector<std::pair<int, float>> forceX, forceY;
+  };
+  std::vector<MatrixChunk> chunks_;
+
   void placeInstsCenter();
   void setPlaceInstExtId();
   void updatePinInfo();
   void createSparseMatrix();
+  void addNetEntries(Net* net, MatrixChunk& chunk) const;
   void updateCoordi();
   void reset();
 };
@@ -70,40 +70,104 @@ static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
 
 static float fastExp(float exp);
 
+////////////////////////////////////////////////
+// GCellStore / GNetStore / GPinStore
+
+int GCellStore::add()
+{
+  const int id = lx.size();
+  lx.push_back(0);
+  ly.push_back(0);
+  ux.push_back(0);
+  uy.push_back(0);
+  dLx.push_back(0);
+  dLy.push_back(0);
+  dUx.push_back(0);
+  dUy.push_back(0);
+  densityScale.push_back(0);
+  gradientX.push_back(0);
+  gradientY.push_back(0);
+  return id;
+}
+
+void GCellStore::clear()
+{
+  *this = GCellStore();
+}
+
+int GNetStore::add()
+{
+  const int id = lx.size();
+  lx.push_back(0);
+  ly.push_back(0);
+  ux.push_back(0);
+  uy.push_back(0);
+  timingWeight.push_back(1);
+  customWeight.push_back(1);
+  waExpMinSumX.push_back(0);
+  waXExpMinSumX.push_back(0);
+  waExpMaxSumX.push_back(0);
+  waXExpMaxSumX.push_back(0);
+  waExpMinSumY.push_back(0);
+  waYExpMinSumY.push_back(0);
+  waExpMaxSumY.push_back(0);
+  waYExpMaxSumY.push_back(0);
+  pinBegin.push_back(0);
+  pinEnd.push_back(0);
+  return id;
+}
+
+void GNetStore::clear()
+{
+  *this = GNetStore();
+}
+
+int GPinStore::add()
+{
+  const int id = cx.size();
+  cx.push_back(0);
+  cy.push_back(0);
+  maxExpSumX.push_back(0);
+  maxExpSumY.push_back(0);
+  minExpSumX.push_back(0);
+  minExpSumY.push_back(0);
+  hasMaxExpSumX.push_back(0);
+  hasMaxExpSumY.push_back(0);
+  hasMinExpSumX.push_back(0);
+  hasMinExpSumY.push_back(0);
+  return id;
+}
+
+void GPinStore::clear()
+{
+  *this = GPinStore();
+}
+
 ////////////////////////////////////////////////
 // GCell
 
-GCell::GCell()
-    : lx_(0),
-      ly_(0),
-      ux_(0),
-      uy_(0),
-      dLx_(0),
-      dLy_(0),
-      dUx_(0),
-      dUy_(0),
-      densityScale_(0),
-      gradientX_(0),
-      gradientY_(0)
+GCell::GCell(GCellStore* store) : store_(store), id_(store->add())
 {
 }
 
-GCell::GCell(Instance* inst) : GCell()
+GCell::GCell(GCellStore* store, Instance* inst) : GCell(store)
 {
   setInstance(inst);
 }
 
-GCell::GCell(const std::vector<Instance*>& insts) : GCell()
+GCell::GCell(GCellStore* store, const std::vector<Instance*>& insts)
+    : GCell(store)
 {
   setClusteredInstance(insts);
 }
 
-GCell::GCell(int cx, int cy, int dx, int dy) : GCell()
+GCell::GCell(GCellStore* store, int cx, int cy, int dx, int dy)
+    : GCell(store)
 {
-  dLx_ = lx_ = cx - dx / 2;
-  dLy_ = ly_ = cy - dy / 2;
-  dUx_ = ux_ = cx + dx / 2;
-  dUy_ = uy_ = cy + dy / 2;
+  store_->dLx[id_] = store_->lx[id_] = cx - dx / 2;
+  store_->dLy[id_] = store_->ly[id_] = cy - dy / 2;
+  store_->dUx[id_] = store_->ux[id_] = cx + dx / 2;
+  store_->dUy[id_] = store_->uy[id_] = cy + dy / 2;
   setFiller();
 }
 
@@ -116,10 +180,10 @@ void GCell::setInstance(Instance* inst)
 {
   insts_.push_back(inst);
   // density coordi has the same center points.
-  dLx_ = lx_ = inst->lx();
-  dLy_ = ly_ = inst->ly();
-  dUx_ = ux_ = inst->ux();
-  dUy_ = uy_ = inst->uy();
+  store_->dLx[id_] = store_->lx[id_] = inst->lx();
+  store_->dLy[id_] = store_->ly[id_] = inst->ly();
+  store_->dUx[id_] = store_->ux[id_] = inst->ux();
+  store_->dUy[id_] = store_->uy[id_] = inst->uy();
 }
 
 Instance* GCell::instance() const
@@ -144,10 +208,10 @@ void GCell::setClusteredInstance(const std::vector<Instance*>& insts)
 
 void GCell::setLocation(int lx, int ly)
 {
-  ux_ = lx + (ux_ - lx_);
-  uy_ = ly + (uy_ - ly_);
-  lx = lx_;
-  ly = ly_;
+  store_->ux[id_] = lx + dx();
+  store_->uy[id_] = ly + dy();
+  store_->lx[id_] = lx;
+  store_->ly[id_] = ly;
 
   for (auto& gPin : gPins_) {
     gPin->updateLocation(this);
@@ -159,10 +223,10 @@ void GCell::setCenterLocation(int cx, int cy)
   const int halfDx = dx() / 2;
   const int halfDy = dy() / 2;
 
-  lx_ = cx - halfDx;
-  ly_ = cy - halfDy;
-  ux_ = cx + halfDx;
-  uy_ = cy + halfDy;
+  store_->lx[id_] = cx - halfDx;
+  store_->ly[id_] = cy - halfDy;
+  store_->ux[id_] = cx + halfDx;
+  store_->uy[id_] = cy + halfDy;
 
   for (auto& gPin : gPins_) {
     gPin->updateLocation(this);
@@ -175,18 +239,18 @@ void GCell::setSize(int dx, int dy)
   const int centerX = cx();
   const int centerY = cy();
 
-  lx_ = centerX - dx / 2;
-  ly_ = centerY - dy / 2;
-  ux_ = centerX + dx / 2;
-  uy_ = centerY + dy / 2;
+  store_->lx[id_] = centerX - dx / 2;
+  store_->ly[id_] = centerY - dy / 2;
+  store_->ux[id_] = centerX + dx / 2;
+  store_->uy[id_] = centerY + dy / 2;
 }
 
 void GCell::setDensityLocation(int dLx, int dLy)
 {
-  dUx_ = dLx + (dUx_ - dLx_);
-  dUy_ = dLy + (dUy_ - dLy_);
-  dLx_ = dLx;
-  dLy_ = dLy;
+  store_->dUx[id_] = dLx + dDx();
+  store_->dUy[id_] = dLy + dDy();
+  store_->dLx[id_] = dLx;
+  store_->dLy[id_] = dLy;
 
   // assume that density Center change the gPin coordi
   for (auto& gPin : gPins_) {
@@ -199,10 +263,10 @@ void GCell::setDensityCenterLocation(int dCx, int dCy)
   const int halfDDx = dDx() / 2;
   const int halfDDy = dDy() / 2;
 
-  dLx_ = dCx - halfDDx;
-  dLy_ = dCy - halfDDy;
-  dUx_ = dCx + halfDDx;
-  dUy_ = dCy + halfDDy;
+  store_->dLx[id_] = dCx - halfDDx;
+  store_->dLy[id_] = dCy - halfDDy;
+  store_->dUx[id_] = dCx + halfDDx;
+  store_->dUy[id_] = dCy + halfDDy;
 
   // assume that density Center change the gPin coordi
   for (auto& gPin : gPins_) {
@@ -216,25 +280,25 @@ void GCell::setDensitySize(int dDx, int dDy)
   const int dCenterX = dCx();
   const int dCenterY = dCy();
 
-  dLx_ = dCenterX - dDx / 2;
-  dLy_ = dCenterY - dDy / 2;
-  dUx_ = dCenterX + dDx / 2;
-  dUy_ = dCenterY + dDy / 2;
+  store_->dLx[id_] = dCenterX - dDx / 2;
+  store_->dLy[id_] = dCenterY - dDy / 2;
+  store_->dUx[id_] = dCenterX + dDx / 2;
+  store_->dUy[id_] = dCenterY + dDy / 2;
 }
 
 void GCell::setDensityScale(float densityScale)
 {
-  densityScale_ = densityScale;
+  store_->densityScale[id_] = densityScale;
 }
 
 void GCell::setGradientX(float gradientX)
 {
-  gradientX_ = gradientX;
+  store_->gradientX[id_] = gradientX;
 }
 
 void GCell::setGradientY(float gradientY)
 {
-  gradientY_ = gradientY;
+  store_->gradientY[id_] = gradientY;
 }
 
 bool GCell::isInstance() const
@@ -271,31 +335,17 @@ bool GCell::isStdInstance() const
 ////////////////////////////////////////////////
 // GNet
 
-GNet::GNet()
-    : lx_(0),
-      ly_(0),
-      ux_(0),
-      uy_(0),
-      timingWeight_(1),
-      customWeight_(1),
-      waExpMinSumX_(0),
-      waXExpMinSumX_(0),
-      waExpMaxSumX_(0),
-      waXExpMaxSumX_(0),
-      waExpMinSumY_(0),
-      waYExpMinSumY_(0),
-      waExpMaxSumY_(0),
-      waYExpMaxSumY_(0),
-      isDontCare_(0)
+GNet::GNet(GNetStore* store)
+    : store_(store), id_(store->add()), isDontCare_(0)
 {
 }
 
-GNet::GNet(Net* net) : GNet()
+GNet::GNet(GNetStore* store, Net* net) : GNet(store)
 {
   nets_.push_back(net);
 }
 
-GNet::GNet(const std::vector<Net*>& nets) : GNet()
+GNet::GNet(GNetStore* store, const std::vector<Net*>& nets) : GNet(store)
 {
   nets_ = nets;
 }
@@ -313,12 +363,12 @@ Net* GNet::net() const
 
 void GNet::setTimingWeight(float timingWeight)
 {
-  timingWeight_ = timingWeight;
+  store_->timingWeight[id_] = timingWeight;
 }
 
 void GNet::setCustomWeight(float customWeight)
 {
-  customWeight_ = customWeight;
+  store_->customWeight[id_] = customWeight;
 }
 
 void GNet::addGPin(GPin* gPin)
@@ -328,42 +378,49 @@ void GNet::addGPin(GPin* gPin)
 
 void GNet::updateBox()
 {
-  lx_ = ly_ = INT_MAX;
-  ux_ = uy_ = INT_MIN;
+  int lx = INT_MAX;
+  int ly = INT_MAX;
+  int ux = INT_MIN;
+  int uy = INT_MIN;
 
   for (auto& gPin : gPins_) {
-    lx_ = std::min(gPin->cx(), lx_);
-    ly_ = std::min(gPin->cy(), ly_);
-    ux_ = std::max(gPin->cx(), ux_);
-    uy_ = std::max(gPin->cy(), uy_);
+    lx = std::min(gPin->cx(), lx);
+    ly = std::min(gPin->cy(), ly);
+    ux = std::max(gPin->cx(), ux);
+    uy = std::max(gPin->cy(), uy);
   }
+
+  store_->lx[id_] = lx;
+  store_->ly[id_] = ly;
+  store_->ux[id_] = ux;
+  store_->uy[id_] = uy;
 }
 
 int64_t GNet::hpwl() const
 {
-  if (ux_ < lx_) {  // dangling net
+  if (ux() < lx()) {  // dangling net
     return 0;
   }
-  int64_t lx = lx_;
-  int64_t ly = ly_;
-  int64_t ux = ux_;
-  int64_t uy = uy_;
+  int64_t lx = this->lx();
+  int64_t ly = this->ly();
+  int64_t ux = this->ux();
+  int64_t uy = this->uy();
   return (ux - lx) + (uy - ly);
 }
 
 void GNet::clearWaVars()
 {
-  waExpMinSumX_ = 0;
-  waXExpMinSumX_ = 0;
+  store_->waExpMinSumX[id_] = 0;
+  store_->waXExpMinSumX[id_] = 0;
 
-  waExpMaxSumX_ = 0;
-  waXExpMaxSumX_ = 0;
+  store_->waExpMaxSumX[id_] = 0;
+  store_->waXExpMaxSumX[id_] = 0;
 
-  waExpMinSumY_ = 0;
-  waYExpMinSumY_ = 0;
+  store_->waExpMinSumY[id_] = 0;
+  store_->waYExpMinSumY[id_] = 0;
 
-  waExpMaxSumY_ = 0;
-  waYExpMaxSumY_ = 0;
+  store_->waExpMaxSumY[id_] = 0;
+  store_->waYExpMaxSumY[id_] = 0;
 }
 
 void GNet::setDontCare()
@@ -379,34 +436,26 @@ bool GNet::isDontCare() const
 ////////////////////////////////////////////////
 // GPin
 
-GPin::GPin()
-    : gCell_(nullptr),
+GPin::GPin(GPinStore* store)
+    : store_(store),
+      id_(store->add()),
+      gCell_(nullptr),
       gNet_(nullptr),
       offsetCx_(0),
-      offsetCy_(0),
-      cx_(0),
-      cy_(0),
-      maxExpSumX_(0),
-      maxExpSumY_(0),
-      minExpSumX_(0),
-      minExpSumY_(0),
-      hasMaxExpSumX_(0),
-      hasMaxExpSumY_(0),
-      hasMinExpSumX_(0),
-      hasMinExpSumY_(0)
+      offsetCy_(0)
 {
 }
 
-GPin::GPin(Pin* pin) : GPin()
+GPin::GPin(GPinStore* store, Pin* pin) : GPin(store)
 {
   pins_.push_back(pin);
-  cx_ = pin->cx();
-  cy_ = pin->cy();
+  store_->cx[id_] = pin->cx();
+  store_->cy[id_] = pin->cy();
   offsetCx_ = pin->offsetCx();
   offsetCy_ = pin->offsetCy();
 }
 
-GPin::GPin(const std::vector<Pin*>& pins) : GPin()
+GPin::GPin(GPinStore* store, const std::vector<Pin*>& pins) : GPin(store)
 {
   pins_ = pins;
 }
@@ -435,55 +484,55 @@ void GPin::setGNet(GNet* gNet)
 
 void GPin::setCenterLocation(int cx, int cy)
 {
-  cx_ = cx;
-  cy_ = cy;
+  store_->cx[id_] = cx;
+  store_->cy[id_] = cy;
 }
 
 void GPin::clearWaVars()
 {
-  hasMaxExpSumX_ = 0;
-  hasMaxExpSumY_ = 0;
-  hasMinExpSumX_ = 0;
-  hasMinExpSumY_ = 0;
+  store_->hasMaxExpSumX[id_] = 0;
+  store_->hasMaxExpSumY[id_] = 0;
+  store_->hasMinExpSumX[id_] = 0;
+  store_->hasMinExpSumY[id_] = 0;
 
-  maxExpSumX_ = maxExpSumY_ = 0;
-  minExpSumX_ = minExpSumY_ = 0;
+  store_->maxExpSumX[id_] = store_->maxExpSumY[id_] = 0;
+  store_->minExpSumX[id_] = store_->minExpSumY[id_] = 0;
 }
 
 void GPin::setMaxExpSumX(float maxExpSumX)
 {
-  hasMaxExpSumX_ = 1;
-  maxExpSumX_ = maxExpSumX;
+  store_->hasMaxExpSumX[id_] = 1;
+  store_->maxExpSumX[id_] = maxExpSumX;
 }
 
 void GPin::setMaxExpSumY(float maxExpSumY)
 {
-  hasMaxExpSumY_ = 1;
-  maxExpSumY_ = maxExpSumY;
+  store_->hasMaxExpSumY[id_] = 1;
+  store_->maxExpSumY[id_] = maxExpSumY;
 }
 
 void GPin::setMinExpSumX(float minExpSumX)
 {
-  hasMinExpSumX_ = 1;
-  minExpSumX_ = minExpSumX;
+  store_->hasMinExpSumX[id_] = 1;
+  store_->minExpSumX[id_] = minExpSumX;
 }
 
 void GPin::setMinExpSumY(float minExpSumY)
 {
-  hasMinExpSumY_ = 1;
-  minExpSumY_ = minExpSumY;
+  store_->hasMinExpSumY[id_] = 1;
+  store_->minExpSumY[id_] = minExpSumY;
 }
 
 void GPin::updateLocation(const GCell* gCell)
 {
-  cx_ = gCell->cx() + offsetCx_;
-  cy_ = gCell->cy() + offsetCy_;
+  store_->cx[id_] = gCell->cx() + offsetCx_;
+  store_->cy[id_] = gCell->cy() + offsetCy_;
 }
 
 void GPin::updateDensityLocation(const GCell* gCell)
 {
-  cx_ = gCell->dCx() + offsetCx_;
-  cy_ = gCell->dCy() + offsetCy_;
+  store_->cx[id_] = gCell->dCx() + offsetCx_;
+  store_->cy[id_] = gCell->dCy() + offsetCy_;
 }
 
 ////////////////////////////////////////////////////////
@@ -598,6 +647,7 @@ BinGrid::BinGrid()
       targetDensity_(0),
       overflowArea_(0),
       overflowAreaUnscaled_(0),
+      numThreads_(1),
       isSetBinCnt_(0)
 {
 }
@@ -640,6 +690,11 @@ void BinGrid::setTargetDensity(float density)
   targetDensity_ = density;
 }
 
+void BinGrid::setNumThreads(int threads)
+{
+  numThreads_ = threads;
+}
+
 void BinGrid::setBinCnt(int binCntX, int binCntY)
 {
   isSetBinCnt_ = 1;
@@ -841,7 +896,12 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
     bin.setFillerArea(0);
   }
 
-  for (auto& cell : cells) {
+  // Cells may overlap the same bins, so the Bin::add* calls below are
+  // atomic. All areas are truncated to int64_t before accumulation
+  // which keeps the result independent of the thread count.
+#pragma omp parallel for num_threads(numThreads_)
+  for (size_t idx = 0; idx < cells.size(); idx++) {
+    const GCell* cell = cells[idx];
     std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
     std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
 
@@ -887,18 +947,25 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
     }
   }
 
-  overflowArea_ = 0;
-  overflowAreaUnscaled_ = 0;
-  // update density and overflowArea
-  // for nesterov use and FFT library
-  for (Bin& bin : bins_) {
-    int64_t binArea = bin.binArea();
+  // update density for nesterov use and FFT library
+#pragma omp parallel for num_threads(numThreads_)
+  for (size_t idx = 0; idx < bins_.size(); idx++) {
+    Bin& bin = bins_[idx];
     const float scaledBinArea
-        = static_cast<float>(binArea * bin.targetDensity());
+        = static_cast<float>(bin.binArea() * bin.targetDensity());
     bin.setDensity((static_cast<float>(bin.instPlacedArea())
                     + static_cast<float>(bin.fillerArea())
                     + static_cast<float>(bin.nonPlaceArea()))
                    / scaledBinArea);
+  }
+
+  // update overflowArea; kept sequential as the float accumulation
+  // is order dependent.
+  overflowArea_ = 0;
+  overflowAreaUnscaled_ = 0;
+  for (const Bin& bin : bins_) {
+    const float scaledBinArea
+        = static_cast<float>(bin.binArea() * bin.targetDensity());
 
     overflowArea_ += std::max(0.0f,
                               static_cast<float>(bin.instPlacedArea())
@@ -966,6 +1033,8 @@ void NesterovBaseVars::reset()
   targetDensity = 1.0;
   binCntX = binCntY = 0;
   minWireLengthForceBar = -300;
+  numThreads = 1;
+  fftBackend = FFTBackend::Threaded;
   isSetBinCnt = 0;
   useUniformTargetDensity = 0;
 }
@@ -1021,6 +1090,10 @@ void NesterovBase::reset()
   gNetStor_.clear();
   gPinStor_.clear();
 
+  gCellStore_.clear();
+  gNetStore_.clear();
+  gPinStore_.clear();
+
   gCells_.clear();
   gCellInsts_.clear();
   gCellFillers_.clear();
@@ -1071,24 +1144,27 @@ void NesterovBase::init()
     int y_offset = rand() % (2 * dbu_per_micron) - dbu_per_micron;
     inst->setLocation(inst->lx() + x_offset, inst->ly() + y_offset);
 
-    gCellStor_.push_back(GCell(inst));
+    gCellStor_.push_back(GCell(&gCellStore_, inst));
   }
 
   // TODO:
   // at this moment, GNet and GPin is equal to
   // Net and Pin
 
-  // gPinStor init
+  // gPinStor / gNetStor init
+  //
+  // GPins are created net by net so that the pins of a gNet occupy
+  // a contiguous range in gPinStore_ (see updateWireLengthForceWA).
   gPinStor_.reserve(pb_->pins().size());
-  for (auto& pin : pb_->pins()) {
-    GPin myGPin(pin);
-    gPinStor_.push_back(myGPin);
-  }
-
-  // gNetStor init
   gNetStor_.reserve(pb_->nets().size());
   for (auto& net : pb_->nets()) {
-    GNet myGNet(net);
+    GNet myGNet(&gNetStore_, net);
+    gNetStore_.pinBegin[myGNet.id()] = gPinStor_.size();
+    for (auto& pin : net->pins()) {
+      GPin myGPin(&gPinStore_, pin);
+      gPinStor_.push_back(myGPin);
+    }
+    gNetStore_.pinEnd[myGNet.id()] = gPinStor_.size();
     gNetStor_.push_back(myGNet);
   }
 
@@ -1159,13 +1235,18 @@ void NesterovBase::init()
   bg_.setLogger(log_);
   bg_.setCorePoints(&(pb_->die()));
   bg_.setTargetDensity(targetDensity_);
+  bg_.setNumThreads(nbVars_.numThreads);
 
   // update binGrid info
   bg_.initBins();
 
   // initialize fft structrue based on bins
-  std::unique_ptr<FFT> fft(
-      new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  std::unique_ptr<FFT> fft(new FFT(bg_.binCntX(),
+                                   bg_.binCntY(),
+                                   bg_.binSizeX(),
+                                   bg_.binSizeY(),
+                                   nbVars_.fftBackend,
+                                   nbVars_.numThreads));
 
   fft_ = std::move(fft);
 
@@ -1271,7 +1352,8 @@ void NesterovBase::initFillerGCells()
 
     // place filler cells on random coordi and
     // set size as avgDx and avgDy
-    GCell myGCell(randX % pb_->die().coreDx() + pb_->die().coreLx(),
+    GCell myGCell(&gCellStore_,
+                  randX % pb_->die().coreDx() + pb_->die().coreLx(),
                   randY % pb_->die().coreDy() + pb_->die().coreLy(),
                   fillerDx_,
                   fillerDy_);
@@ -1344,9 +1426,10 @@ void NesterovBase::updateGCellCenterLocation(
 void NesterovBase::updateGCellDensityCenterLocation(
     const std::vector<FloatPoint>& coordis)
 {
-  for (auto& coordi : coordis) {
-    int idx = &coordi - &coordis[0];
-    gCells_[idx]->setDensityCenterLocation(coordi.x, coordi.y);
+  // each gCell only updates its own gPins
+#pragma omp parallel for num_threads(nbVars_.numThreads)
+  for (size_t idx = 0; idx < coordis.size(); idx++) {
+    gCells_[idx]->setDensityCenterLocation(coordis[idx].x, coordis[idx].y);
   }
   bg_.updateBinsGCellDensityArea(gCells_);
 }
@@ -1456,7 +1539,9 @@ float NesterovBase::targetDensity() const
 // update densitySize and densityScale in each gCell
 void NesterovBase::updateDensitySize()
 {
-  for (auto& gCell : gCells_) {
+#pragma omp parallel for num_threads(nbVars_.numThreads)
+  for (size_t idx = 0; idx < gCells_.size(); idx++) {
+    GCell* gCell = gCells_[idx];
     float scaleX = 0, scaleY = 0;
     float densitySizeX = 0, densitySizeY = 0;
     if (gCell->dx() < REPLACE_SQRT2 * bg_.binSizeX()) {
@@ -1613,94 +1698,133 @@ float NesterovBase::getDensityCoordiLayoutInsideY(const GCell* gCell,
 // in ePlace paper.
 void NesterovBase::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
-  // clear all WA variables.
-  for (auto& gNet : gNets_) {
-    gNet->clearWaVars();
-  }
-  for (auto& gPin : gPins_) {
-    gPin->clearWaVars();
-  }
-
-  for (auto& gNet : gNets_) {
-    gNet->updateBox();
+  GPinStore& pins = gPinStore_;
+  GNetStore& nets = gNetStore_;
+  const float minForceBar = nbVars_.minWireLengthForceBar;
+
+  // A gPin belongs to exactly one gNet and the pins of a gNet are
+  // contiguous in gPinStore_, so nets can be processed independently
+  // while sweeping the SoA arrays linearly.
+#pragma omp parallel for num_threads(nbVars_.numThreads) schedule(dynamic, 64)
+  for (size_t idx = 0; idx < gNets_.size(); idx++) {
+    const int netId = gNets_[idx]->id();
+    const int begin = nets.pinBegin[netId];
+    const int end = nets.pinEnd[netId];
+
+    int netLx = INT_MAX;
+    int netLy = INT_MAX;
+    int netUx = INT_MIN;
+    int netUy = INT_MIN;
+    for (int k = begin; k < end; k++) {
+      netLx = std::min(pins.cx[k], netLx);
+      netLy = std::min(pins.cy[k], netLy);
+      netUx = std::max(pins.cx[k], netUx);
+      netUy = std::max(pins.cy[k], netUy);
+    }
+    nets.lx[netId] = netLx;
+    nets.ly[netId] = netLy;
+    nets.ux[netId] = netUx;
+    nets.uy[netId] = netUy;
 
-    for (auto& gPin : gNet->gPins()) {
-      // The WA terms are shift invariant:
-      //
-      //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
-      //   -----------------    = -----------------
-      //   Sum(exp(x_i))          Sum(exp(x_i - C))
-      //
-      // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
+    // The WA terms are shift invariant:
+    //
+    //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
+    //   -----------------    = -----------------
+    //   Sum(exp(x_i))          Sum(exp(x_i - C))
+    //
+    // So we shift to keep the exponential from overflowing.
+    //
+    // The exponents are independent per pin and are vectorized;
+    // terms below minWireLengthForceBar are masked out.
+    const int* cx = pins.cx.data();
+    const int* cy = pins.cy.data();
+    unsigned char* hasMinExpSumX = pins.hasMinExpSumX.data();
+    unsigned char* hasMaxExpSumX = pins.hasMaxExpSumX.data();
+    unsigned char* hasMinExpSumY = pins.hasMinExpSumY.data();
+    unsigned char* hasMaxExpSumY = pins.hasMaxExpSumY.data();
+    float* minExpSumX = pins.minExpSumX.data();
+    float* maxExpSumX = pins.maxExpSumX.data();
+    float* minExpSumY = pins.minExpSumY.data();
+    float* maxExpSumY = pins.maxExpSumY.data();
+#pragma omp simd
+    for (int k = begin; k < end; k++) {
+      const float expMinX = (netLx - cx[k]) * wlCoeffX;
+      const float expMaxX = (cx[k] - netUx) * wlCoeffX;
+      const float expMinY = (netLy - cy[k]) * wlCoeffY;
+      const float expMaxY = (cy[k] - netUy) * wlCoeffY;
+
+      const bool hasMinX = expMinX > minForceBar;
+      const bool hasMaxX = expMaxX > minForceBar;
+      const bool hasMinY = expMinY > minForceBar;
+      const bool hasMaxY = expMaxY > minForceBar;
+
+      hasMinExpSumX[k] = hasMinX;
+      hasMaxExpSumX[k] = hasMaxX;
+      hasMinExpSumY[k] = hasMinY;
+      hasMaxExpSumY[k] = hasMaxY;
+
+      // Clamping keeps the masked-out lanes finite, so multiplying by
+      // the flag is exact and avoids a branch in the vector loop.
+      minExpSumX[k] = fastExp(hasMinX ? expMinX : minForceBar) * hasMinX;
+      maxExpSumX[k] = fastExp(hasMaxX ? expMaxX : minForceBar) * hasMaxX;
+      minExpSumY[k] = fastExp(hasMinY ? expMinY : minForceBar) * hasMinY;
+      maxExpSumY[k] = fastExp(hasMaxY ? expMaxY : minForceBar) * hasMaxY;
+    }
 
+    // The net sums are accumulated in pin order so the float results
+    // do not depend on the vector width.
+    float waExpMinSumX = 0, waXExpMinSumX = 0;
+    float waExpMaxSumX = 0, waXExpMaxSumX = 0;
+    float waExpMinSumY = 0, waYExpMinSumY = 0;
+    float waExpMaxSumY = 0, waYExpMaxSumY = 0;
+    for (int k = begin; k < end; k++) {
       // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumX());
-        }
+      if (pins.hasMinExpSumX[k]) {
+        waExpMinSumX += pins.minExpSumX[k];
+        waXExpMinSumX += pins.cx[k] * pins.minExpSumX[k];
       }
 
       // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumX());
-        }
+      if (pins.hasMaxExpSumX[k]) {
+        waExpMaxSumX += pins.maxExpSumX[k];
+        waXExpMaxSumX += pins.cx[k] * pins.maxExpSumX[k];
       }
 
       // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumY());
-        }
+      if (pins.hasMinExpSumY[k]) {
+        waExpMinSumY += pins.minExpSumY[k];
+        waYExpMinSumY += pins.cy[k] * pins.minExpSumY[k];
       }
 
       // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumY());
-        }
+      if (pins.hasMaxExpSumY[k]) {
+        waExpMaxSumY += pins.maxExpSumY[k];
+        waYExpMaxSumY += pins.cy[k] * pins.maxExpSumY[k];
+      }
+
+      const GPin& gPin = gPinStor_[k];
+      if (gPin.gCell() && gPin.gCell()->isInstance()) {
+        debugPrint(log_,
+                   GPL,
+                   "wlUpdateWA",
+                   1,
+                   "{} MinX {:g} MaxX {:g} MinY {:g} MaxY {:g}",
+                   gPin.gCell()->instance()->dbInst()->getConstName(),
+                   gPin.minExpSumX(),
+                   gPin.maxExpSumX(),
+                   gPin.minExpSumY(),
+                   gPin.maxExpSumY());
       }
     }
+
+    nets.waExpMinSumX[netId] = waExpMinSumX;
+    nets.waXExpMinSumX[netId] = waXExpMinSumX;
+    nets.waExpMaxSumX[netId] = waExpMaxSumX;
+    nets.waXExpMaxSumX[netId] = waXExpMaxSumX;
+    nets.waExpMinSumY[netId] = waExpMinSumY;
+    nets.waYExpMinSumY[netId] = waYExpMinSumY;
+    nets.waExpMaxSumY[netId] = waExpMaxSumY;
+    nets.waYExpMaxSumY[netId] = waYExpMaxSumY;
   }
 }
 
@@ -1853,8 +1977,12 @@ FloatPoint NesterovBase::getDensityGradient(const GCell* gCell) const
 // Density force cals
 void NesterovBase::updateDensityForceBin()
 {
+  std::vector<Bin>& bins = bg_.bins();
+
   // copy density to utilize FFT
-  for (Bin& bin : bg_.bins()) {
+#pragma omp parallel for num_threads(nbVars_.numThreads)
+  for (size_t idx = 0; idx < bins.size(); idx++) {
+    const Bin& bin = bins[idx];
     fft_->updateDensity(bin.x(), bin.y(), bin.density());
   }
 
@@ -1862,16 +1990,18 @@ void NesterovBase::updateDensityForceBin()
   fft_->doFFT();
 
   // update electroPhi and electroForce
-  // update sumPhi_ for nesterov loop
-  sumPhi_ = 0;
-  for (Bin& bin : bg_.bins()) {
+#pragma omp parallel for num_threads(nbVars_.numThreads)
+  for (size_t idx = 0; idx < bins.size(); idx++) {
+    Bin& bin = bins[idx];
     auto eForcePair = fft_->getElectroForce(bin.x(), bin.y());
     bin.setElectroForce(eForcePair.first, eForcePair.second);
+    bin.setElectroPhi(fft_->getElectroPhi(bin.x(), bin.y()));
+  }
 
-    float electroPhi = fft_->getElectroPhi(bin.x(), bin.y());
-    bin.setElectroPhi(electroPhi);
-
-    sumPhi_ += electroPhi
+  // update sumPhi_ for nesterov loop
+  sumPhi_ = 0;
+  for (const Bin& bin : bins) {
+    sumPhi_ += bin.electroPhi()
                * static_cast<float>(bin.nonPlaceArea() + bin.instPlacedArea()
                                     + bin.fillerArea());
   }
@@ -1881,22 +2011,29 @@ void NesterovBase::updateDbGCells()
 {
   for (auto& gCell : gCells()) {
     if (gCell->isInstance()) {
-      odb::dbInst* inst = gCell->instance()->dbInst();
-      inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
-
-      Instance* replInst = gCell->instance();
-      // pad awareness on X coordinates
-      inst->setLocation(
-          gCell->dCx() - replInst->dx() / 2 + pb_->siteSizeX() * pb_->padLeft(),
-          gCell->dCy() - replInst->dy() / 2);
+      updateDbGCell(gCell);
     }
   }
 }
 
+void NesterovBase::updateDbGCell(GCell* gCell)
+{
+  odb::dbInst* inst = gCell->instance()->dbInst();
+  inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
+
+  Instance* replInst = gCell->instance();
+  // pad awareness on X coordinates
+  inst->setLocation(
+      gCell->dCx() - replInst->dx() / 2 + pb_->siteSizeX() * pb_->padLeft(),
+      gCell->dCy() - replInst->dy() / 2);
+}
+
 int64_t NesterovBase::getHpwl()
 {
   int64_t hpwl = 0;
-  for (auto& gNet : gNets_) {
+#pragma omp parallel for num_threads(nbVars_.numThreads) reduction(+ : hpwl)
+  for (size_t idx = 0; idx < gNets_.size(); idx++) {
+    GNet* gNet = gNets_[idx];
     gNet->updateBox();
     hpwl += gNet->hpwl();
   }
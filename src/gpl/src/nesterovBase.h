@@ -37,6 +37,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "fft.h"
 #include "point.h"
 
 namespace odb {
@@ -61,21 +62,105 @@ class Pin;
 class Net;
 
 class GPin;
-class FFT;
 
-class GCell
+//
+// Structure-of-arrays storage for the GCell/GNet/GPin fields that
+// the Nesterov loop touches every iteration. GCell, GNet and GPin are
+// thin views holding an index into these arrays, so the hot loops
+// sweep contiguous memory instead of chasing object pointers.
+//
+class GCellStore
+{
+ public:
+  // append a zero-initialized entry and return its index
+  int add();
+  void clear();
+  size_t size() const { return lx.size(); }
+
+  // normal coordinates
+  std::vector<int> lx;
+  std::vector<int> ly;
+  std::vector<int> ux;
+  std::vector<int> uy;
+
+  // virtual density coordinates
+  std::vector<int> dLx;
+  std::vector<int> dLy;
+  std::vector<int> dUx;
+  std::vector<int> dUy;
+
+  std::vector<float> densityScale;
+  std::vector<float> gradientX;
+  std::vector<float> gradientY;
+};
+
+class GNetStore
+{
+ public:
+  int add();
+  void clear();
+  size_t size() const { return lx.size(); }
+
+  std::vector<int> lx;
+  std::vector<int> ly;
+  std::vector<int> ux;
+  std::vector<int> uy;
+
+  std::vector<float> timingWeight;
+  std::vector<float> customWeight;
+
+  // see the WA description in GNet
+  std::vector<float> waExpMinSumX;
+  std::vector<float> waXExpMinSumX;
+  std::vector<float> waExpMaxSumX;
+  std::vector<float> waXExpMaxSumX;
+
+  std::vector<float> waExpMinSumY;
+  std::vector<float> waYExpMinSumY;
+  std::vector<float> waExpMaxSumY;
+  std::vector<float> waYExpMaxSumY;
+
+  // GPins of a net are stored contiguously in GPinStore:
+  // [pinBegin, pinEnd)
+  std::vector<int> pinBegin;
+  std::vector<int> pinEnd;
+};
+
+class GPinStore
 {
  public:
-  GCell();
+  int add();
+  void clear();
+  size_t size() const { return cx.size(); }
+
+  std::vector<int> cx;
+  std::vector<int> cy;
+
+  // see the WA description in GPin
+  std::vector<float> maxExpSumX;
+  std::vector<float> maxExpSumY;
+  std::vector<float> minExpSumX;
+  std::vector<float> minExpSumY;
+
+  std::vector<unsigned char> hasMaxExpSumX;
+  std::vector<unsigned char> hasMaxExpSumY;
+  std::vector<unsigned char> hasMinExpSumX;
+  std::vector<unsigned char> hasMinExpSumY;
+};
 
+class GCell
+{
+ public:
   // instance cells
-  GCell(Instance* inst);
-  GCell(const std::vector<Instance*>& insts);
+  GCell(GCellStore* store, Instance* inst);
+  GCell(GCellStore* store, const std::vector<Instance*>& insts);
 
   // filler cells
-  GCell(int cx, int cy, int dx, int dy);
+  GCell(GCellStore* store, int cx, int cy, int dx, int dy);
   ~GCell();
 
+  int id() const { return id_; }
+
   Instance* instance() const;
   const std::vector<Instance*>& insts() const { return insts_; }
   const std::vector<GPin*>& gPins() const { return gPins_; }
@@ -118,9 +203,9 @@ class GCell
   void setGradientX(float gradX);
   void setGradientY(float gradY);
 
-  float gradientX() const { return gradientX_; }
-  float gradientY() const { return gradientY_; }
-  float densityScale() const { return densityScale_; }
+  float gradientX() const { return store_->gradientX[id_]; }
+  float gradientY() const { return store_->gradientY[id_]; }
+  float densityScale() const { return store_->densityScale[id_]; }
 
   bool isInstance() const;
   bool isClusteredInstance() const;
@@ -129,110 +214,102 @@ class GCell
   bool isStdInstance() const;
 
  private:
+  explicit GCell(GCellStore* store);
+
+  GCellStore* store_;
+  int id_;
   std::vector<Instance*> insts_;
   std::vector<GPin*> gPins_;
-  int lx_;
-  int ly_;
-  int ux_;
-  int uy_;
-
-  int dLx_;
-  int dLy_;
-  int dUx_;
-  int dUy_;
-
-  float densityScale_;
-  float gradientX_;
-  float gradientY_;
 };
 
 inline int GCell::lx() const
 {
-  return lx_;
+  return store_->lx[id_];
 }
 inline int GCell::ly() const
 {
-  return ly_;
+  return store_->ly[id_];
 }
 
 inline int GCell::ux() const
 {
-  return ux_;
+  return store_->ux[id_];
 }
 
 inline int GCell::uy() const
 {
-  return uy_;
+  return store_->uy[id_];
 }
 
 inline int GCell::cx() const
 {
-  return (lx_ + ux_) / 2;
+  return (lx() + ux()) / 2;
 }
 
 inline int GCell::cy() const
 {
-  return (ly_ + uy_) / 2;
+  return (ly() + uy()) / 2;
 }
 
 inline int GCell::dx() const
 {
-  return ux_ - lx_;
+  return ux() - lx();
 }
 
 inline int GCell::dy() const
 {
-  return uy_ - ly_;
+  return uy() - ly();
 }
 
 inline int GCell::dLx() const
 {
-  return dLx_;
+  return store_->dLx[id_];
 }
 
 inline int GCell::dLy() const
 {
-  return dLy_;
+  return store_->dLy[id_];
 }
 
 inline int GCell::dUx() const
 {
-  return dUx_;
+  return store_->dUx[id_];
 }
 
 inline int GCell::dUy() const
 {
-  return dUy_;
+  return store_->dUy[id_];
 }
 
 inline int GCell::dCx() const
 {
-  return (dUx_ + dLx_) / 2;
+  return (dUx() + dLx()) / 2;
 }
 
 inline int GCell::dCy() const
 {
-  return (dUy_ + dLy_) / 2;
+  return (dUy() + dLy()) / 2;
 }
 
 inline int GCell::dDx() const
 {
-  return dUx_ - dLx_;
+  return dUx() - dLx();
 }
 
 inline int GCell::dDy() const
 {
-  return dUy_ - dLy_;
+  return dUy() - dLy();
 }
 
 class GNet
 {
  public:
-  GNet();
-  GNet(Net* net);
-  GNet(const std::vector<Net*>& nets);
+  GNet(GNetStore* store, Net* net);
+  GNet(GNetStore* store, const std::vector<Net*>& nets);
   ~GNet();
 
+  int id() const { return id_; }
+
   Net* net() const;
   const std::vector<Net*>& nets() const { return nets_; }
   const std::vector<GPin*>& gPins() const { return gPins_; }
@@ -245,9 +322,9 @@ class GNet
   void setTimingWeight(float timingWeight);
   void setCustomWeight(float customWeight);
 
-  float totalWeight() const { return timingWeight_ * customWeight_; }
-  float timingWeight() const { return timingWeight_; }
-  float customWeight() const { return customWeight_; }
+  float totalWeight() const { return timingWeight() * customWeight(); }
+  float timingWeight() const { return store_->timingWeight[id_]; }
+  float customWeight() const { return store_->customWeight[id_]; }
 
   void addGPin(GPin* gPin);
   void updateBox();
@@ -284,15 +361,12 @@ class GNet
   float waYExpMaxSumY() const;
 
  private:
+  explicit GNet(GNetStore* store);
+
+  GNetStore* store_;
+  int id_;
   std::vector<GPin*> gPins_;
   std::vector<Net*> nets_;
-  int lx_;
-  int ly_;
-  int ux_;
-  int uy_;
-
-  float timingWeight_;
-  float customWeight_;
 
   //
   // weighted average WL model stor for better indexing
@@ -306,143 +380,134 @@ class GNet
   //
   // X forces.
   //
-  // waExpMinSumX_: store sigma {exp(x_i/gamma)}
-  // waXExpMinSumX_: store signa {x_i*exp(e_i/gamma)}
-  // waExpMaxSumX_ : store sigma {exp(-x_i/gamma)}
-  // waXExpMaxSumX_: store sigma {x_i*exp(-x_i/gamma)}
-  //
-  float waExpMinSumX_;
-  float waXExpMinSumX_;
-
-  float waExpMaxSumX_;
-  float waXExpMaxSumX_;
-
+  // waExpMinSumX: store sigma {exp(x_i/gamma)}
+  // waXExpMinSumX: store signa {x_i*exp(e_i/gamma)}
+  // waExpMaxSumX : store sigma {exp(-x_i/gamma)}
+  // waXExpMaxSumX: store sigma {x_i*exp(-x_i/gamma)}
   //
   // Y forces.
   //
-  // waExpMinSumY_: store sigma {exp(y_i/gamma)}
-  // waYExpMinSumY_: store signa {y_i*exp(e_i/gamma)}
-  // waExpMaxSumY_ : store sigma {exp(-y_i/gamma)}
-  // waYExpMaxSumY_: store sigma {y_i*exp(-y_i/gamma)}
+  // waExpMinSumY: store sigma {exp(y_i/gamma)}
+  // waYExpMinSumY: store signa {y_i*exp(e_i/gamma)}
+  // waExpMaxSumY : store sigma {exp(-y_i/gamma)}
+  // waYExpMaxSumY: store sigma {y_i*exp(-y_i/gamma)}
+  //
+  // The values live in GNetStore.
   //
-  float waExpMinSumY_;
-  float waYExpMinSumY_;
-
-  float waExpMaxSumY_;
-  float waYExpMaxSumY_;
 
   unsigned char isDontCare_ : 1;
 };
 
 inline int GNet::lx() const
 {
-  return lx_;
+  return store_->lx[id_];
 }
 
 inline int GNet::ly() const
 {
-  return ly_;
+  return store_->ly[id_];
 }
 
 inline int GNet::ux() const
 {
-  return ux_;
+  return store_->ux[id_];
 }
 
 inline int GNet::uy() const
 {
-  return uy_;
+  return store_->uy[id_];
 }
 
 // eight add functions
 inline void GNet::addWaExpMinSumX(float waExpMinSumX)
 {
-  waExpMinSumX_ += waExpMinSumX;
+  store_->waExpMinSumX[id_] += waExpMinSumX;
 }
 
 inline void GNet::addWaXExpMinSumX(float waXExpMinSumX)
 {
-  waXExpMinSumX_ += waXExpMinSumX;
+  store_->waXExpMinSumX[id_] += waXExpMinSumX;
 }
 
 inline void GNet::addWaExpMinSumY(float waExpMinSumY)
 {
-  waExpMinSumY_ += waExpMinSumY;
+  store_->waExpMinSumY[id_] += waExpMinSumY;
 }
 
 inline void GNet::addWaYExpMinSumY(float waYExpMinSumY)
 {
-  waYExpMinSumY_ += waYExpMinSumY;
+  store_->waYExpMinSumY[id_] += waYExpMinSumY;
 }
 
 inline void GNet::addWaExpMaxSumX(float waExpMaxSumX)
 {
-  waExpMaxSumX_ += waExpMaxSumX;
+  store_->waExpMaxSumX[id_] += waExpMaxSumX;
 }
 
 inline void GNet::addWaXExpMaxSumX(float waXExpMaxSumX)
 {
-  waXExpMaxSumX_ += waXExpMaxSumX;
+  store_->waXExpMaxSumX[id_] += waXExpMaxSumX;
 }
 
 inline void GNet::addWaExpMaxSumY(float waExpMaxSumY)
 {
-  waExpMaxSumY_ += waExpMaxSumY;
+  store_->waExpMaxSumY[id_] += waExpMaxSumY;
 }
 
 inline void GNet::addWaYExpMaxSumY(float waYExpMaxSumY)
 {
-  waYExpMaxSumY_ += waYExpMaxSumY;
+  store_->waYExpMaxSumY[id_] += waYExpMaxSumY;
 }
 
 inline float GNet::waExpMinSumX() const
 {
-  return waExpMinSumX_;
+  return store_->waExpMinSumX[id_];
 }
 
 inline float GNet::waXExpMinSumX() const
 {
-  return waXExpMinSumX_;
+  return store_->waXExpMinSumX[id_];
 }
 
 inline float GNet::waExpMinSumY() const
 {
-  return waExpMinSumY_;
+  return store_->waExpMinSumY[id_];
 }
 
 inline float GNet::waYExpMinSumY() const
 {
-  return waYExpMinSumY_;
+  return store_->waYExpMinSumY[id_];
 }
 
 inline float GNet::waExpMaxSumX() const
 {
-  return waExpMaxSumX_;
+  return store_->waExpMaxSumX[id_];
 }
 
 inline float GNet::waXExpMaxSumX() const
 {
-  return waXExpMaxSumX_;
+  return store_->waXExpMaxSumX[id_];
 }
 
 inline float GNet::waExpMaxSumY() const
 {
-  return waExpMaxSumY_;
+  return store_->waExpMaxSumY[id_];
 }
 
 inline float GNet::waYExpMaxSumY() const
 {
-  return waYExpMaxSumY_;
+  return store_->waYExpMaxSumY[id_];
 }
 
 class GPin
 {
  public:
-  GPin();
-  GPin(Pin* pin);
-  GPin(const std::vector<Pin*>& pins);
+  GPin(GPinStore* store, Pin* pin);
+  GPin(GPinStore* store, const std::vector<Pin*>& pins);
   ~GPin();
 
+  int id() const { return id_; }
+
   Pin* pin() const;
   const std::vector<Pin*>& pins() const { return pins_; }
 
@@ -452,8 +517,8 @@ class GPin
   void setGCell(GCell* gCell);
   void setGNet(GNet* gNet);
 
-  int cx() const { return cx_; }
-  int cy() const { return cy_; }
+  int cx() const { return store_->cx[id_]; }
+  int cy() const { return store_->cy[id_]; }
 
   // clear WA(Weighted Average) variables.
   void clearWaVars();
@@ -463,52 +528,43 @@ class GPin
   void setMinExpSumX(float minExpSumX);
   void setMinExpSumY(float minExpSumY);
 
-  float maxExpSumX() const { return maxExpSumX_; }
-  float maxExpSumY() const { return maxExpSumY_; }
-  float minExpSumX() const { return minExpSumX_; }
-  float minExpSumY() const { return minExpSumY_; }
+  float maxExpSumX() const { return store_->maxExpSumX[id_]; }
+  float maxExpSumY() const { return store_->maxExpSumY[id_]; }
+  float minExpSumX() const { return store_->minExpSumX[id_]; }
+  float minExpSumY() const { return store_->minExpSumY[id_]; }
 
-  bool hasMaxExpSumX() const { return (hasMaxExpSumX_ == 1); }
-  bool hasMaxExpSumY() const { return (hasMaxExpSumY_ == 1); }
-  bool hasMinExpSumX() const { return (hasMinExpSumX_ == 1); }
-  bool hasMinExpSumY() const { return (hasMinExpSumY_ == 1); }
+  bool hasMaxExpSumX() const { return (store_->hasMaxExpSumX[id_] == 1); }
+  bool hasMaxExpSumY() const { return (store_->hasMaxExpSumY[id_] == 1); }
+  bool hasMinExpSumX() const { return (store_->hasMinExpSumX[id_] == 1); }
+  bool hasMinExpSumY() const { return (store_->hasMinExpSumY[id_] == 1); }
 
   void setCenterLocation(int cx, int cy);
   void updateLocation(const GCell* gCell);
   void updateDensityLocation(const GCell* gCell);
 
  private:
+  explicit GPin(GPinStore* store);
+
+  GPinStore* store_;
+  int id_;
   GCell* gCell_;
   GNet* gNet_;
   std::vector<Pin*> pins_;
 
   int offsetCx_;
   int offsetCy_;
-  int cx_;
-  int cy_;
 
   // weighted average WL vals stor for better indexing
   // Please check the equation (4) in the ePlace-MS paper.
   //
-  // maxExpSum_: holds exp(x_i/gamma)
-  // minExpSum_: holds exp(-x_i/gamma)
-  // the x_i is equal to cx_ variable.
+  // maxExpSum: holds exp(x_i/gamma)
+  // minExpSum: holds exp(-x_i/gamma)
+  // the x_i is equal to the cx variable.
   //
-  float maxExpSumX_;
-  float maxExpSumY_;
-
-  float minExpSumX_;
-  float minExpSumY_;
-
-  // flag variables
-  //
-  // check whether
+  // The hasMaxExpSum/hasMinExpSum flags check whether
   // this pin is considered in a WA models.
-  unsigned char hasMaxExpSumX_ : 1;
-  unsigned char hasMaxExpSumY_ : 1;
-
-  unsigned char hasMinExpSumX_ : 1;
-  unsigned char hasMinExpSumY_ : 1;
+  //
+  // The values live in GPinStore.
 };
 
 class Bin
@@ -642,8 +698,12 @@ inline void Bin::addNonPlaceArea(int64_t area)
   nonPlaceArea_ += area;
 }
 
+// The following three are accumulated from several threads in
+// BinGrid::updateBinsGCellDensityArea. The areas are integral so the
+// atomic sums are independent of the thread interleaving.
 inline void Bin::addInstPlacedArea(int64_t area)
 {
+#pragma omp atomic
   instPlacedArea_ += area;
 }
 
@@ -654,11 +714,13 @@ inline void Bin::addNonPlaceAreaUnscaled(int64_t area)
 
 inline void Bin::addInstPlacedAreaUnscaled(int64_t area)
 {
+#pragma omp atomic
   instPlacedAreaUnscaled_ += area;
 }
 
 inline void Bin::addFillerArea(int64_t area)
 {
+#pragma omp atomic
   fillerArea_ += area;
 }
 
@@ -678,6 +740,7 @@ class BinGrid
   void setCorePoints(const Die* die);
   void setBinCnt(int binCntX, int binCntY);
   void setTargetDensity(float density);
+  void setNumThreads(int threads);
   void updateBinsGCellDensityArea(const std::vector<GCell*>& cells);
 
   void initBins();
@@ -727,6 +790,7 @@ class BinGrid
   float targetDensity_;
   int64_t overflowArea_;
   int64_t overflowAreaUnscaled_;
+  int numThreads_;
 
   unsigned char isSetBinCnt_ : 1;
 };
@@ -743,6 +807,8 @@ class NesterovBaseVars
   int binCntX;
   int binCntY;
   float minWireLengthForceBar;
+  int numThreads;
+  FFTBackend fftBackend;
   // temp variables
   unsigned char isSetBinCnt : 1;
   unsigned char useUniformTargetDensity : 1;
@@ -884,6 +950,7 @@ class NesterovBase
   void updateDensityForceBin();
 
   void updateDbGCells();
+  void updateDbGCell(GCell* gCell);
 
   BinGrid& getBinGrid() { return bg_; }
 
@@ -903,6 +970,11 @@ class NesterovBase
   int64_t stdInstsArea_;
   int64_t macroInstsArea_;
 
+  // SoA storage viewed by the gCellStor_/gNetStor_/gPinStor_ objects
+  GCellStore gCellStore_;
+  GNetStore gNetStore_;
+  GPinStore gPinStore_;
+
   std::vector<GCell> gCellStor_;
   std::vector<GNet> gNetStor_;
   std::vector<GPin> gPinStor_;
@@ -84,6 +84,7 @@ void NesterovPlaceVars::reset()
   debug_update_iterations = 10;
   debug_draw_bins = true;
   debug_inst = nullptr;
+  numThreads = 1;
 }
 
 NesterovPlace::NesterovPlace()
@@ -365,24 +366,18 @@ void NesterovPlace::updateGradients(std::vector<FloatPoint>& sumGrads,
   debugPrint(
       log_, GPL, "updateGrad", 1, "DensityPenalty: {:g}", densityPenalty_);
 
-  for (size_t i = 0; i < nb_->gCells().size(); i++) {
-    GCell* gCell = nb_->gCells().at(i);
+  const std::vector<GCell*>& gCells = nb_->gCells();
+
+  // The per-cell gradients are independent; the sums are reduced
+  // afterwards in index order so the result does not depend on
+  // the thread count.
+#pragma omp parallel for num_threads(npVars_.numThreads)
+  for (size_t i = 0; i < gCells.size(); i++) {
+    GCell* gCell = gCells[i];
     wireLengthGrads[i] = nb_->getWireLengthGradientWA(
         gCell, wireLengthCoefX_, wireLengthCoefY_);
     densityGrads[i] = nb_->getDensityGradient(gCell);
 
-    // Different compiler has different results on the following formula.
-    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
-    //
-    // To prevent instability problem,
-    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
-    //
-    wireLengthGradSum_ += fabs(wireLengthGrads[i].x);
-    wireLengthGradSum_ += fabs(wireLengthGrads[i].y);
-
-    densityGradSum_ += fabs(densityGrads[i].x);
-    densityGradSum_ += fabs(densityGrads[i].y);
-
     sumGrads[i].x = wireLengthGrads[i].x + densityPenalty_ * densityGrads[i].x;
     sumGrads[i].y = wireLengthGrads[i].y + densityPenalty_ * densityGrads[i].y;
 
@@ -403,6 +398,20 @@ void NesterovPlace::updateGradients(std::vector<FloatPoint>& sumGrads,
 
     sumGrads[i].x /= sumPrecondi.x;
     sumGrads[i].y /= sumPrecondi.y;
+  }
+
+  for (size_t i = 0; i < gCells.size(); i++) {
+    // Different compiler has different results on the following formula.
+    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
+    //
+    // To prevent instability problem,
+    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
+    //
+    wireLengthGradSum_ += fabs(wireLengthGrads[i].x);
+    wireLengthGradSum_ += fabs(wireLengthGrads[i].y);
+
+    densityGradSum_ += fabs(densityGrads[i].x);
+    densityGradSum_ += fabs(densityGrads[i].y);
 
     gradSum += fabs(sumGrads[i].x) + fabs(sumGrads[i].y);
   }
@@ -511,6 +520,7 @@ int NesterovPlace::doNesterovPlace(int start_iter)
     int numBackTrak = 0;
     for (numBackTrak = 0; numBackTrak < npVars_.maxBackTrack; numBackTrak++) {
       // fill in nextCoordinates with given stepLength_
+#pragma omp parallel for num_threads(npVars_.numThreads)
       for (size_t k = 0; k < nb_->gCells().size(); k++) {
         FloatPoint nextCoordi(
             curSLPCoordi_[k].x + stepLength_ * curSLPSumGrads_[k].x,
@@ -776,6 +786,7 @@ void NesterovPlace::updateWireLengthCoef(float overflow)
 
 void NesterovPlace::updateInitialPrevSLPCoordi()
 {
+#pragma omp parallel for num_threads(npVars_.numThreads)
   for (size_t i = 0; i < nb_->gCells().size(); i++) {
     GCell* curGCell = nb_->gCells()[i];
 
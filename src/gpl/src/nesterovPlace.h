@@ -82,6 +82,7 @@ class NesterovPlaceVars
   int debug_update_iterations;
   bool debug_draw_bins;
   odb::dbInst* debug_inst;
+  int numThreads;
 
   NesterovPlaceVars();
   void reset();
@@ -33,6 +33,7 @@
 
 #include "gpl/Replace.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "initialPlace.h"
@@ -82,6 +83,7 @@ Replace::Replace()
       routabilityTargetRcMetric_(1.25),
       routabilityInflationRatioCoef_(2.5),
       routabilityMaxInflationRatio_(2.5),
+      routabilityMoveThreshold_(0.5),
       routabilityRcK1_(1.0),
       routabilityRcK2_(1.0),
       routabilityRcK3_(0.0),
@@ -95,6 +97,9 @@ Replace::Replace()
       skipIoMode_(false),
       padLeft_(0),
       padRight_(0),
+      numThreads_(1),
+      fftBackend_("threaded"),
+      initialPlaceSolver_("bicgstab"),
       gui_debug_(false),
       gui_debug_pause_iterations_(10),
       gui_debug_update_iterations_(10),
@@ -149,6 +154,7 @@ void Replace::reset()
   routabilityTargetRcMetric_ = 1.25;
   routabilityInflationRatioCoef_ = 2.5;
   routabilityMaxInflationRatio_ = 2.5;
+  routabilityMoveThreshold_ = 0.5;
   routabilityRcK1_ = routabilityRcK2_ = 1.0;
   routabilityRcK3_ = routabilityRcK4_ = 0.0;
   routabilityMaxBloatIter_ = 1;
@@ -161,6 +167,10 @@ void Replace::reset()
 
   padLeft_ = padRight_ = 0;
 
+  numThreads_ = 1;
+  fftBackend_ = "threaded";
+  initialPlaceSolver_ = "bicgstab";
+
   timingNetWeightOverflows_.clear();
   timingNetWeightOverflows_.shrink_to_fit();
   timingNetWeightMax_ = 1.9;
@@ -248,6 +258,12 @@ void Replace::doInitialPlace()
   ipVars.netWeightScale = initialPlaceNetWeightScale_;
   ipVars.debug = gui_debug_initial_;
   ipVars.forceCPU = forceCPU_;
+  ipVars.numThreads = numThreads_;
+  if (initialPlaceSolver_ == "cg") {
+    ipVars.solver = InitialPlaceSolver::ConjugateGradient;
+  } else if (initialPlaceSolver_ == "cg_ic") {
+    ipVars.solver = InitialPlaceSolver::ConjugateGradientCholesky;
+  }
 
   std::unique_ptr<InitialPlace> ip(new InitialPlace(ipVars, pb_, log_));
   ip_ = std::move(ip);
@@ -281,6 +297,8 @@ bool Replace::initNesterovPlace()
     }
 
     nbVars.useUniformTargetDensity = uniformTargetDensityMode_;
+    nbVars.numThreads = numThreads_;
+    FFT::parseBackend(fftBackend_, nbVars.fftBackend);
 
     nb_ = std::make_shared<NesterovBase>(nbVars, pb_, log_);
   }
@@ -293,6 +311,7 @@ bool Replace::initNesterovPlace()
     rbVars.targetRC = routabilityTargetRcMetric_;
     rbVars.inflationRatioCoef = routabilityInflationRatioCoef_;
     rbVars.maxInflationRatio = routabilityMaxInflationRatio_;
+    rbVars.moveThreshold = routabilityMoveThreshold_;
     rbVars.rcK1 = routabilityRcK1_;
     rbVars.rcK2 = routabilityRcK2_;
     rbVars.rcK3 = routabilityRcK3_;
@@ -325,6 +344,7 @@ bool Replace::initNesterovPlace()
     npVars.debug_update_iterations = gui_debug_update_iterations_;
     npVars.debug_draw_bins = gui_debug_draw_bins_;
     npVars.debug_inst = gui_debug_inst_;
+    npVars.numThreads = numThreads_;
 
     std::unique_ptr<NesterovPlace> np(
         new NesterovPlace(npVars, pb_, nb_, rb_, tb_, log_));
@@ -500,6 +520,11 @@ void Replace::setRoutabilityMaxInflationRatio(float ratio)
   routabilityMaxInflationRatio_ = ratio;
 }
 
+void Replace::setRoutabilityMoveThreshold(float threshold)
+{
+  routabilityMoveThreshold_ = threshold;
+}
+
 void Replace::setRoutabilityRcCoefficients(float k1,
                                            float k2,
                                            float k3,
@@ -531,4 +556,35 @@ void Replace::setTimingNetWeightMax(float max)
   timingNetWeightMax_ = max;
 }
 
+void Replace::setNumThreads(int threads)
+{
+  numThreads_ = std::max(threads, 1);
+}
+
+void Replace::setFftBackend(const std::string& backend)
+{
+  FFTBackend fftBackend = FFTBackend::Threaded;
+  if (!FFT::parseBackend(backend, fftBackend)) {
+    log_->error(GPL,
+                122,
+                "Unknown FFT backend {}. Use ooura, threaded or fftw.",
+                backend);
+  }
+  if (fftBackend == FFTBackend::FFTW && !FFT::hasFFTW()) {
+    log_->error(GPL, 123, "The fftw backend requires building with FFTW.");
+  }
+  fftBackend_ = backend;
+}
+
+void Replace::setInitialPlaceSolver(const std::string& solver)
+{
+  if (solver != "bicgstab" && solver != "cg" && solver != "cg_ic") {
+    log_->error(GPL,
+                124,
+                "Unknown initial place solver {}. Use bicgstab, cg or cg_ic.",
+                solver);
+  }
+  initialPlaceSolver_ = solver;
+}
+
 }  // namespace gpl
@@ -205,6 +205,13 @@ set_routability_max_inflation_ratio_cmd(float ratio)
   replace->setRoutabilityMaxInflationRatio(ratio);
 }
 
+void
+set_routability_move_threshold_cmd(float threshold)
+{
+  Replace* replace = getReplace();
+  replace->setRoutabilityMoveThreshold(threshold);
+}
+
 void
 set_routability_rc_coefficients_cmd(float k1,
                                     float k2,
@@ -258,6 +265,27 @@ set_timing_driven_net_weight_max_cmd(float max)
   return replace->setTimingNetWeightMax(max);
 }
 
+void
+set_num_threads_cmd(int threads)
+{
+  Replace* replace = getReplace();
+  replace->setNumThreads(threads);
+}
+
+void
+set_fft_backend_cmd(const char* backend)
+{
+  Replace* replace = getReplace();
+  replace->setFftBackend(backend);
+}
+
+void
+set_initial_place_solver_cmd(const char* solver)
+{
+  Replace* replace = getReplace();
+  replace->setInitialPlaceSolver(solver);
+}
+
 void
 set_debug_cmd(int pause_iterations,
               int update_iterations,
@@ -51,6 +51,7 @@ sta::define_cmd_args "global_placement" {\
     [-overflow overflow]\
     [-initial_place_max_iter initial_place_max_iter]\
     [-initial_place_max_fanout initial_place_max_fanout]\
+    [-initial_place_solver initial_place_solver]\
     [-routability_check_overflow routability_check_overflow]\
     [-routability_max_density routability_max_density]\
     [-routability_max_bloat_iter routability_max_bloat_iter]\
@@ -59,11 +60,13 @@ sta::define_cmd_args "global_placement" {\
     [-routability_inflation_ratio_coef routability_inflation_ratio_coef]\
     [-routability_max_inflation_ratio routability_max_inflation_ratio]\
     [-routability_rc_coefficients routability_rc_coefficients]\
+    [-routability_move_threshold routability_move_threshold]\
     [-timing_driven_net_reweight_overflow timing_driven_net_reweight_overflow]\
     [-timing_driven_net_weight_max timing_driven_net_weight_max]\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
+    [-fft_backend backend]\
 }
 
 proc global_placement { args } {
@@ -73,16 +76,18 @@ proc global_placement { args } {
       -min_phi_coef -max_phi_coef -overflow \
       -reference_hpwl \
       -initial_place_max_iter -initial_place_max_fanout \
+      -initial_place_solver \
       -routability_check_overflow -routability_max_density \
       -routability_max_bloat_iter -routability_max_inflation_iter \
       -routability_target_rc_metric \
       -routability_inflation_ratio_coef \
       -routability_max_inflation_ratio \
       -routability_rc_coefficients \
+      -routability_move_threshold \
       -timing_driven_net_reweight_overflow \
       -timing_driven_net_weight_max \
       -timing_driven_nets_percentage \
-      -pad_left -pad_right} \
+      -pad_left -pad_right -fft_backend} \
     flags {-skip_initial_place \
       -skip_nesterov_place \
       -timing_driven \
@@ -163,6 +168,10 @@ proc global_placement { args } {
     sta::check_positive_integer "-initial_place_max_fanout" $initial_place_max_fanout
     gpl::set_initial_place_max_fanout_cmd $initial_place_max_fanout
   }
+
+  if { [info exists keys(-initial_place_solver)] } {
+    gpl::set_initial_place_solver_cmd $keys(-initial_place_solver)
+  }
   
   # density settings    
   set target_density 0.7
@@ -279,6 +288,13 @@ proc global_placement { args } {
     sta::check_positive_float "-routability_max_inflation_ratio" $max_inflation_ratio
     gpl::set_routability_max_inflation_ratio_cmd $max_inflation_ratio
   }
+
+  # routability incremental estimate threshold
+  if { [info exists keys(-routability_move_threshold)] } {
+    set move_threshold $keys(-routability_move_threshold)
+    sta::check_positive_float "-routability_move_threshold" $move_threshold
+    gpl::set_routability_move_threshold_cmd $move_threshold
+  }
   
   # routability rc coefficients control
   if { [info exists keys(-routability_rc_coefficients)] } {
@@ -302,6 +318,12 @@ proc global_placement { args } {
     gpl::set_pad_right_cmd $pad_right
   }
 
+  gpl::set_num_threads_cmd [thread_count]
+
+  if { [info exists keys(-fft_backend)] } {
+    gpl::set_fft_backend_cmd $keys(-fft_backend)
+  }
+
   if { [ord::db_has_rows] } {
     sta::check_argc_eq0 "global_placement" $args
   
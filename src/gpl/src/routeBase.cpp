@@ -287,6 +287,8 @@ void RouteBaseVars::reset()
   rcK3 = rcK4 = 0.0;
   maxBloatIter = 1;
   maxInflationIter = 4;
+  moveThreshold = 0.5;
+  maxMovedRatio = 0.3;
 }
 
 /////////////////////////////////////////////
@@ -354,6 +356,8 @@ void RouteBase::resetRoutabilityResources()
 
   grouter_->clear();
   tg_.reset();
+  tileRatios_.clear();
+  routedGCellCenters_.clear();
 }
 
 void RouteBase::init()
@@ -368,18 +372,76 @@ void RouteBase::init()
 
 void RouteBase::getGlobalRouterResult()
 {
-  // update gCells' location to DB for GR
-  nb_->updateDbGCells();
+  if (!incrementalGlobalRoute()) {
+    // update gCells' location to DB for GR
+    nb_->updateDbGCells();
 
-  // these two options must be on
-  grouter_->setAllowCongestion(true);
-  grouter_->setOverflowIterations(1);
+    // these two options must be on
+    grouter_->setAllowCongestion(true);
+    grouter_->setOverflowIterations(1);
 
-  grouter_->globalRoute();
+    grouter_->globalRoute();
+
+    routedGCellCenters_.resize(nb_->gCells().size());
+    for (size_t idx = 0; idx < nb_->gCells().size(); idx++) {
+      GCell* gCell = nb_->gCells()[idx];
+      routedGCellCenters_[idx] = std::make_pair(gCell->dCx(), gCell->dCy());
+    }
+  }
 
   updateRoute();
 }
 
+bool RouteBase::incrementalGlobalRoute()
+{
+  const std::vector<GCell*>& gCells = nb_->gCells();
+  if (rbVars_.moveThreshold <= 0
+      || routedGCellCenters_.size() != gCells.size()) {
+    return false;
+  }
+
+  const int threshold
+      = static_cast<int>(rbVars_.moveThreshold * grouter_->getTileSize());
+  int instCnt = 0;
+  std::vector<int> movedGCells;
+  for (size_t idx = 0; idx < gCells.size(); idx++) {
+    GCell* gCell = gCells[idx];
+    if (!gCell->isInstance()) {
+      continue;
+    }
+    instCnt++;
+
+    const std::pair<int, int>& center = routedGCellCenters_[idx];
+    if (std::abs(gCell->dCx() - center.first) > threshold
+        || std::abs(gCell->dCy() - center.second) > threshold) {
+      movedGCells.push_back(idx);
+    }
+  }
+
+  if (movedGCells.size() > rbVars_.maxMovedRatio * instCnt) {
+    return false;
+  }
+
+  log_->info(GPL,
+             76,
+             "Incremental global route: {} of {} instances moved.",
+             movedGCells.size(),
+             instCnt);
+
+  // The db callbacks of IncrementalGRoute mark the nets of every moved
+  // instance dirty; instances below the threshold keep their db location
+  // (and their routes) until the next full update.
+  grt::IncrementalGRoute incrGRoute(grouter_, db_->getChip()->getBlock());
+  for (int idx : movedGCells) {
+    GCell* gCell = gCells[idx];
+    nb_->updateDbGCell(gCell);
+    routedGCellCenters_[idx] = std::make_pair(gCell->dCx(), gCell->dCy());
+  }
+  incrGRoute.updateRoutes(true);
+
+  return true;
+}
+
 int64_t RouteBase::inflatedAreaDelta() const
 {
   return inflatedAreaDelta_;
@@ -444,6 +506,23 @@ static float getUsageCapacityRatio(Tile* tile,
   return static_cast<float>(curUse) / curCap;
 }
 
+void RouteBase::updateTileRatios()
+{
+  odb::dbGCellGrid* gGrid = db_->getChip()->getBlock()->getGCellGrid();
+  odb::dbTech* tech = db_->getTech();
+
+  tileRatios_.resize(tg_->numRoutingLayers());
+  for (int i = 1; i <= tg_->numRoutingLayers(); i++) {
+    odb::dbTechLayer* layer = tech->findRoutingLayer(i);
+    std::vector<float>& ratios = tileRatios_[i - 1];
+    ratios.resize(tg_->tiles().size());
+    for (auto& tile : tg_->tiles()) {
+      ratios[tile->y() * tg_->tileCntX() + tile->x()] = getUsageCapacityRatio(
+          tile, layer, gGrid, rbVars_.ignoreEdgeRatio);
+    }
+  }
+}
+
 // fill
 //
 // TileGrids'
@@ -470,28 +549,28 @@ void RouteBase::updateRoute()
   tg_->setTileCnt(gridX.size(), gridY.size());
   tg_->initTiles();
 
+  updateTileRatios();
+
   for (int i = 1; i <= numLayers; i++) {
     odb::dbTechLayer* layer = tech->findRoutingLayer(i);
     bool isHorizontalLayer
         = (layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL);
+    const std::vector<float>& ratios = tileRatios_[i - 1];
 
     for (auto& tile : tg_->tiles()) {
       // Check left and down tile
       // and set the minimum usage/cap vals for
       // TileGrid setup.
+      const int tileIdx = tile->y() * tg_->tileCntX() + tile->x();
 
       // first extract current tiles' usage
-      float ratio
-          = getUsageCapacityRatio(tile, layer, gGrid, rbVars_.ignoreEdgeRatio);
+      float ratio = ratios[tileIdx];
 
       // if horizontal layer (i.e., vertical edges)
       // should consider LEFT tile's RIGHT edge == current 'tile's LEFT edge
       // (current 'ratio' points to RIGHT edges usage)
       if (isHorizontalLayer && tile->x() >= 1) {
-        Tile* leftTile
-            = tg_->tiles()[tile->y() * tg_->tileCntX() + tile->x() - 1];
-        float leftRatio = getUsageCapacityRatio(
-            leftTile, layer, gGrid, rbVars_.ignoreEdgeRatio);
+        float leftRatio = ratios[tileIdx - 1];
         ratio = fmax(leftRatio, ratio);
       }
 
@@ -499,10 +578,7 @@ void RouteBase::updateRoute()
       // should consider DOWN tile's UP edge == current 'tile's DOWN edge
       // (current 'ratio' points to UP edges usage)
       if (!isHorizontalLayer && tile->y() >= 1) {
-        Tile* downTile
-            = tg_->tiles()[(tile->y() - 1) * tg_->tileCntX() + tile->x()];
-        float downRatio = getUsageCapacityRatio(
-            downTile, layer, gGrid, rbVars_.ignoreEdgeRatio);
+        float downRatio = ratios[tileIdx - tg_->tileCntX()];
         ratio = fmax(downRatio, ratio);
       }
 
@@ -726,8 +802,10 @@ std::pair<bool, bool> RouteBase::routability()
   // update densitySizes for all gCell
   nb_->updateDensitySize();
 
-  // reset
-  resetRoutabilityResources();
+  // reset, but keep the global routes and routedGCellCenters_ so the
+  // next call only reroutes the nets of moved instances.
+  inflatedAreaDelta_ = 0;
+  tg_.reset();
 
   return make_pair(true, true);
 }
@@ -756,16 +834,20 @@ float RouteBase::getRC() const
   std::vector<double> horEdgeCongArray;
   std::vector<double> verEdgeCongArray;
 
-  odb::dbGCellGrid* gGrid = db_->getChip()->getBlock()->getGCellGrid();
+  std::vector<bool> isHorizontalLayers;
+  for (int i = 1; i <= tg_->numRoutingLayers(); i++) {
+    odb::dbTechLayer* layer = db_->getTech()->findRoutingLayer(i);
+    isHorizontalLayers.push_back(layer->getDirection()
+                                 == odb::dbTechLayerDir::HORIZONTAL);
+  }
+
   for (auto& tile : tg_->tiles()) {
+    const int tileIdx = tile->y() * tg_->tileCntX() + tile->x();
     for (int i = 1; i <= tg_->numRoutingLayers(); i++) {
-      odb::dbTechLayer* layer = db_->getTech()->findRoutingLayer(i);
-      bool isHorizontalLayer
-          = (layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL);
+      bool isHorizontalLayer = isHorizontalLayers[i - 1];
 
       // extract the ratio in the same way as inflation ratio cals
-      float ratio
-          = getUsageCapacityRatio(tile, layer, gGrid, rbVars_.ignoreEdgeRatio);
+      float ratio = tileRatios_[i - 1][tileIdx];
 
       // escape the case when blockageRatio is too huge
       if (ratio >= 0.0f) {
@@ -211,6 +211,13 @@ class RouteBaseVars
   int maxBloatIter;
   int maxInflationIter;
 
+  // Incremental estimate: only the nets of instances whose center moved
+  // more than moveThreshold tiles since the previous estimate are
+  // rerouted. A full global route is run when moveThreshold <= 0 or when
+  // more than maxMovedRatio of the instances moved.
+  float moveThreshold;
+  float maxMovedRatio;
+
   RouteBaseVars();
   void reset();
 };
@@ -270,6 +277,16 @@ class RouteBase
   int minRcViolatedCnt_;
   std::vector<std::pair<int, int>> minRcCellSize_;
 
+  // GCell centers (dCx, dCy) the current global routes were made for,
+  // indexed like nb_->gCells(). Empty when the next estimate must be a
+  // full global route.
+  std::vector<std::pair<int, int>> routedGCellCenters_;
+
+  // tile-demand cache: usage/capacity ratio (see getUsageCapacityRatio)
+  // of every tile, per routing layer. Read once from the dbGCellGrid per
+  // estimate and shared by updateRoute() and getRC().
+  std::vector<std::vector<float>> tileRatios_;
+
   void init();
   void reset();
   void resetRoutabilityResources();
@@ -279,5 +296,10 @@ class RouteBase
 
   // routability funcs
   void initGCells();
+
+  // reroute the nets of moved instances; false if a full global route
+  // is needed instead.
+  bool incrementalGlobalRoute();
+  void updateTileRatios();
 };
 }  // namespace gpl
@@ -58,18 +58,18 @@ ResidualError cudaSparseSolve(int iter,
   return error;
 }
 #endif
-ResidualError cpuSparseSolve(int maxSolverIter,
-                             int iter,
-                             SMatrix& placeInstForceMatrixX,
-                             Eigen::VectorXf& fixedInstForceVecX,
-                             Eigen::VectorXf& instLocVecX,
-                             SMatrix& placeInstForceMatrixY,
-                             Eigen::VectorXf& fixedInstForceVecY,
-                             Eigen::VectorXf& instLocVecY,
-                             utl::Logger* logger)
+
+template <typename Solver>
+static ResidualError sparseSolve(Solver& solver,
+                                 int maxSolverIter,
+                                 SMatrix& placeInstForceMatrixX,
+                                 Eigen::VectorXf& fixedInstForceVecX,
+                                 Eigen::VectorXf& instLocVecX,
+                                 SMatrix& placeInstForceMatrixY,
+                                 Eigen::VectorXf& fixedInstForceVecY,
+                                 Eigen::VectorXf& instLocVecY)
 {
   ResidualError error;
-  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
   solver.setMaxIterations(maxSolverIter);
   solver.compute(placeInstForceMatrixX);
   instLocVecX = solver.solveWithGuess(fixedInstForceVecX, instLocVecX);
@@ -80,4 +80,62 @@ ResidualError cpuSparseSolve(int maxSolverIter,
   error.y = solver.error();
   return error;
 }
+
+ResidualError cpuSparseSolve(InitialPlaceSolver solverType,
+                             int numThreads,
+                             int maxSolverIter,
+                             int iter,
+                             SMatrix& placeInstForceMatrixX,
+                             Eigen::VectorXf& fixedInstForceVecX,
+                             Eigen::VectorXf& instLocVecX,
+                             SMatrix& placeInstForceMatrixY,
+                             Eigen::VectorXf& fixedInstForceVecY,
+                             Eigen::VectorXf& instLocVecY,
+                             utl::Logger* logger)
+{
+  Eigen::setNbThreads(numThreads);
+
+  switch (solverType) {
+    case InitialPlaceSolver::ConjugateGradient: {
+      ConjugateGradient<SMatrix,
+                        Eigen::Lower | Eigen::Upper,
+                        DiagonalPreconditioner<float>>
+          solver;
+      return sparseSolve(solver,
+                         maxSolverIter,
+                         placeInstForceMatrixX,
+                         fixedInstForceVecX,
+                         instLocVecX,
+                         placeInstForceMatrixY,
+                         fixedInstForceVecY,
+                         instLocVecY);
+    }
+    case InitialPlaceSolver::ConjugateGradientCholesky: {
+      ConjugateGradient<SMatrix,
+                        Eigen::Lower | Eigen::Upper,
+                        IncompleteCholesky<float>>
+          solver;
+      return sparseSolve(solver,
+                         maxSolverIter,
+                         placeInstForceMatrixX,
+                         fixedInstForceVecX,
+                         instLocVecX,
+                         placeInstForceMatrixY,
+                         fixedInstForceVecY,
+                         instLocVecY);
+    }
+    case InitialPlaceSolver::BiCGSTAB:
+      break;
+  }
+
+  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
+  return sparseSolve(solver,
+                     maxSolverIter,
+                     placeInstForceMatrixX,
+                     fixedInstForceVecX,
+                     instLocVecX,
+                     placeInstForceMatrixY,
+                     fixedInstForceVecY,
+                     instLocVecY);
+}
 }  // namespace gpl
\ No newline at end of file
@@ -43,6 +43,7 @@
 #include "gpuSolver.h"
 #endif
 #include "graphics.h"
+#include "initialPlace.h"
 #include "odb/db.h"
 #include "placerBase.h"
 #include "utl/Logger.h"
@@ -60,7 +61,10 @@ struct ResidualError
 };
 
 using Eigen::BiCGSTAB;
+using Eigen::ConjugateGradient;
+using Eigen::DiagonalPreconditioner;
 using Eigen::IdentityPreconditioner;
+using Eigen::IncompleteCholesky;
 using utl::GPL;
 
 typedef Eigen::SparseMatrix<float, Eigen::RowMajor> SMatrix;
@@ -76,7 +80,11 @@ ResidualError cudaSparseSolve(int iter,
                               utl::Logger* logger);
 #endif
 
-ResidualError cpuSparseSolve(int maxSolverIter,
+// SpMV inside the solvers runs on numThreads threads (Eigen splits rows
+// between threads, so the result does not depend on the thread count).
+ResidualError cpuSparseSolve(InitialPlaceSolver solverType,
+                             int numThreads,
+                             int maxSolverIter,
                              int iter,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
@@ -11,6 +11,8 @@ record_tests {
   simple04
   simple05
   simple06
+  simple06-cg
+  simple06-cg_ic
   simple07
   simple08
   simple09
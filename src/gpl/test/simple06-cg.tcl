@@ -0,0 +1,9 @@
+source helpers.tcl
+set test_name simple06-cg
+read_lef ./nangate45.lef
+read_def ./simple06.def
+
+global_placement -skip_nesterov_place -initial_place_solver cg
+set def_file [make_result_file $test_name.def]
+write_def $def_file
+diff_file $def_file $test_name.defok
@@ -168,6 +168,7 @@ class GlobalRouter
                            float reduction_percentage);
   void setVerbose(const bool v);
   void setOverflowIterations(int iterations);
+  void setNumThreads(int num_threads);
   void setCongestionReportFile(const char* file_name);
   void setGridOrigin(int x, int y);
   void setAllowCongestion(bool allow_congestion);
@@ -401,6 +402,7 @@ class GlobalRouter
   int layer_for_guide_dimension_;
   int gcells_offset_;
   int overflow_iterations_;
+  int num_threads_;
   bool allow_congestion_;
   std::vector<int> vertical_capacities_;
   std::vector<int> horizontal_capacities_;
@@ -476,7 +478,9 @@ class IncrementalGRoute
   // Saves global router state and enables db callbacks.
   IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block);
   // Update global routes for dirty nets.
-  void updateRoutes();
+  // update_db_congestion also refreshes the dbGCellGrid usage, which
+  // is otherwise left stale (see ~IncrementalGRoute).
+  void updateRoutes(bool update_db_congestion = false);
   // Disables db callbacks.
   ~IncrementalGRoute();
 
@@ -93,6 +93,7 @@ GlobalRouter::GlobalRouter()
       layer_for_guide_dimension_(3),
       gcells_offset_(2),
       overflow_iterations_(50),
+      num_threads_(1),
       allow_congestion_(false),
       macro_extension_(0),
       verbose_(false),
@@ -171,6 +172,7 @@ std::vector<Net*> GlobalRouter::initFastRoute(int min_routing_layer,
 
   fastroute_->setVerbose(verbose_);
   fastroute_->setOverflowIterations(overflow_iterations_);
+  fastroute_->setNumThreads(num_threads_);
 
   initRoutingLayers();
   reportLayerSettings(min_routing_layer, max_routing_layer);
@@ -1328,6 +1330,11 @@ void GlobalRouter::setOverflowIterations(int iterations)
   overflow_iterations_ = iterations;
 }
 
+void GlobalRouter::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void GlobalRouter::setCongestionReportFile(const char* file_name)
 {
   congestion_file_name_ = file_name;
@@ -3841,9 +3848,12 @@ IncrementalGRoute::IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block)
   db_cbk_.addOwner(block);
 }
 
-void IncrementalGRoute::updateRoutes()
+void IncrementalGRoute::updateRoutes(bool update_db_congestion)
 {
   groute_->updateDirtyRoutes();
+  if (update_db_congestion) {
+    groute_->updateDbCongestion();
+  }
 }
 
 IncrementalGRoute::~IncrementalGRoute()
@@ -196,6 +196,7 @@ sta::define_cmd_args "global_route" {[-guide_file out_file] \
                                   [-grid_origin origin] \
                                   [-overflow_iterations iterations] \
                                   [-critical_nets_percentage percent] \
+                                  [-threads count] \
                                   [-allow_congestion] \
                                   [-allow_overflow] \
                                   [-verbose]
@@ -204,7 +205,8 @@ sta::define_cmd_args "global_route" {[-guide_file out_file] \
 proc global_route { args } {
   sta::parse_key_args "global_route" args \
     keys {-guide_file -congestion_iterations -congestion_report_file \
-          -overflow_iterations -grid_origin -critical_nets_percentage
+          -overflow_iterations -grid_origin -critical_nets_percentage \
+          -threads
          } \
     flags {-allow_congestion -allow_overflow -verbose}
 
@@ -258,6 +260,14 @@ proc global_route { args } {
     grt::set_critical_nets_percentage $percentage
   }
 
+  if { [info exists keys(-threads)] } {
+    set threads $keys(-threads)
+    sta::check_positive_integer "-threads" $threads
+    grt::set_num_threads $threads
+  } else {
+    grt::set_num_threads [thread_count]
+  }
+
   if { [info exists flags(-allow_overflow)] } {
     utl::warn GRT 146 "Argument -allow_overflow is deprecated. Use -allow_congestion."
   }
@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Iowa State University All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <omp.h>
+
+#include <algorithm>
+
+// Compares the array-of-structs 2D edge layout FastRoute used before with the
+// EdgeGrid structure-of-arrays layout on the three grid sweeps that dominate
+// the congestion iterations: the getOverflow2D reduction, the
+// updateCongestionHistory update and the maze routing cost lookups.
+//
+// usage: grt_edge_bench [grid_size] [iterations]
+
+#include <algorithm>
+#include <boost/multi_array.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "DataType.h"
+
+namespace {
+
+struct AosEdge
+{
+  short congCNT;
+  unsigned short cap;
+  unsigned short usage;
+  unsigned short red;
+  short last_usage;
+  float est_usage;
+
+  unsigned short usage_red() const { return usage + red; }
+};
+
+using AosGrid = boost::multi_array<AosEdge, 2>;
+
+template <typename Grid>
+void fill(Grid& edges, int rows, int cols)
+{
+  std::mt19937 rng(rows);
+  std::uniform_int_distribution<int> dist(0, 20);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      edges[i][j].cap = 16;
+      edges[i][j].usage = dist(rng);
+      edges[i][j].red = dist(rng) / 10;
+      edges[i][j].last_usage = dist(rng) / 4;
+      edges[i][j].est_usage = dist(rng) * 0.9f;
+      edges[i][j].congCNT = 0;
+    }
+  }
+}
+
+template <typename Grid>
+long overflow(Grid& edges, int rows, int cols)
+{
+  long total = 0;
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      const int overflow = edges[i][j].est_usage - edges[i][j].cap;
+      if (overflow > 0) {
+        total += overflow;
+      }
+    }
+  }
+  return total;
+}
+
+template <typename Grid>
+long history(Grid& edges, int rows, int cols)
+{
+  long total = 0;
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      const int overflow = edges[i][j].usage - edges[i][j].cap;
+      if (overflow > 0) {
+        edges[i][j].congCNT++;
+        edges[i][j].last_usage += overflow;
+      } else {
+        edges[i][j].congCNT = std::max<int>(0, edges[i][j].congCNT - 1);
+        edges[i][j].last_usage = edges[i][j].last_usage * 0.9;
+      }
+      total += edges[i][j].last_usage;
+    }
+  }
+  return total;
+}
+
+// Visits 64x64 windows in random order and reads the maze cost terms of
+// every edge, like the wave expansion of mazeRouteMSMD.
+template <typename Grid>
+long mazeCost(Grid& edges, int rows, int cols)
+{
+  const int window = 64;
+  std::mt19937 rng(cols);
+  long total = 0;
+  const int windows = (rows / window) * (cols / window);
+  for (int w = 0; w < windows; w++) {
+    const int y0 = rng() % (rows - window);
+    const int x0 = rng() % (cols - window);
+    for (int i = y0; i < y0 + window; i++) {
+      for (int j = x0; j < x0 + window; j++) {
+        total += edges[i][j].usage_red() + edges[i][j].last_usage;
+      }
+    }
+  }
+  return total;
+}
+
+template <typename Func>
+double time(Func func, int iterations, long& checksum)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    checksum += func();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count()
+         / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const int size = (argc > 1) ? std::atoi(argv[1]) : 2000;
+  const int iterations = (argc > 2) ? std::atoi(argv[2]) : 10;
+
+  AosGrid aos(boost::extents[size][size]);
+  grt::EdgeGrid soa;
+  soa.resize(size, size);
+  fill(aos, size, size);
+  fill(soa, size, size);
+
+  std::printf("grid %dx%d, iterations %d\n", size, size, iterations);
+  std::printf("%-10s %12s %12s %8s\n", "kernel", "aos ms", "soa ms", "match");
+
+  long aos_sum = 0;
+  long soa_sum = 0;
+  double aos_ms = time(
+      [&] { return overflow(aos, size, size); }, iterations, aos_sum);
+  double soa_ms = time(
+      [&] { return overflow(soa, size, size); }, iterations, soa_sum);
+  std::printf("%-10s %12.3f %12.3f %8s\n",
+              "overflow",
+              aos_ms,
+              soa_ms,
+              aos_sum == soa_sum ? "yes" : "no");
+
+  aos_sum = soa_sum = 0;
+  aos_ms = time([&] { return history(aos, size, size); }, iterations, aos_sum);
+  soa_ms = time([&] { return history(soa, size, size); }, iterations, soa_sum);
+  std::printf("%-10s %12.3f %12.3f %8s\n",
+              "history",
+              aos_ms,
+              soa_ms,
+              aos_sum == soa_sum ? "yes" : "no");
+
+  aos_sum = soa_sum = 0;
+  aos_ms = time([&] { return mazeCost(aos, size, size); }, iterations, aos_sum);
+  soa_ms = time([&] { return mazeCost(soa, size, size); }, iterations, soa_sum);
+  std::printf("%-10s %12.3f %12.3f %8s\n",
+              "maze cost",
+              aos_ms,
+              soa_ms,
+              aos_sum == soa_sum ? "yes" : "no");
+
+  return 0;
+}
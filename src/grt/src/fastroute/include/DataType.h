@@ -128,20 +128,76 @@ struct FrNet  // A Net is a set of connected MazePoints
   bool is_routed_ = false;
 };
 
-struct Edge  // An Edge is the routing track holder between two adjacent
-             // MazePoints
+// An Edge is the routing track holder between two adjacent MazePoints.
+// The 2D edges live in an EdgeGrid and Edge refers to the fields of one of
+// them.
+struct Edge
 {
-  short congCNT;
-  unsigned short cap;    // the capacity of the edge
-  unsigned short usage;  // the usage of the edge
-  unsigned short red;
-  short last_usage;
-  float est_usage;  // the estimated usage of the edge
+  short& congCNT;
+  unsigned short& cap;    // the capacity of the edge
+  unsigned short& usage;  // the usage of the edge
+  unsigned short& red;
+  short& last_usage;
+  float& est_usage;  // the estimated usage of the edge
 
   unsigned short usage_red() const { return usage + red; }
   float est_usage_red() const { return est_usage + red; }
 };
 
+// The 2D edges of one direction, indexed as (Y, X). Every field is kept in its
+// own contiguous array so the sweeps over the grid only load the fields they
+// use and the maze cost lookups touch 6 bytes per edge instead of 16.
+class EdgeGrid
+{
+ public:
+  class Row
+  {
+   public:
+    Row(EdgeGrid* grid, int offset) : grid_(grid), offset_(offset) {}
+    Edge operator[](int x) const { return grid_->edge(offset_ + x); }
+
+   private:
+    EdgeGrid* grid_;
+    int offset_;
+  };
+
+  void resize(int rows, int cols)
+  {
+    rows_ = rows;
+    cols_ = cols;
+    const int size = rows * cols;
+    cong_cnt_.assign(size, 0);
+    cap_.assign(size, 0);
+    usage_.assign(size, 0);
+    red_.assign(size, 0);
+    last_usage_.assign(size, 0);
+    est_usage_.assign(size, 0);
+  }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+
+  Row operator[](int y) { return Row(this, y * cols_); }
+  Edge edge(int idx)
+  {
+    return {cong_cnt_[idx],
+            cap_[idx],
+            usage_[idx],
+            red_[idx],
+            last_usage_[idx],
+            est_usage_[idx]};
+  }
+
+ private:
+  int rows_ = 0;
+  int cols_ = 0;
+  std::vector<short> cong_cnt_;
+  std::vector<unsigned short> cap_;
+  std::vector<unsigned short> usage_;
+  std::vector<unsigned short> red_;
+  std::vector<short> last_usage_;
+  std::vector<float> est_usage_;
+};
+
 struct Edge3D
 {
   unsigned short cap;    // the capacity of the edge
@@ -40,6 +40,7 @@
 #include <boost/icl/interval.hpp>
 #include <boost/icl/interval_set.hpp>
 #include <boost/multi_array.hpp>
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
@@ -163,6 +164,7 @@ class FastRouteCore
   void setMaxNetDegree(int);
   void setVerbose(bool v);
   void setOverflowIterations(int iterations);
+  void setNumThreads(int num_threads);
   void computeCongestionInformation();
   std::vector<int> getOriginalResources();
   const std::vector<int>& getTotalCapacityPerLayer() { return cap_per_layer_; }
@@ -199,6 +201,46 @@ class FastRouteCore
   }
 
  private:
+  // Settings shared by all the nets routed in one mazeRouteMSMD call
+  struct MazeRouteSettings
+  {
+    int iter;
+    int expand;
+    float cost_height;
+    int ripup_threshold;
+    int maze_edge_threshold;
+    int cost_type;
+    float logis_cof;
+    int via;
+    int slope;
+    int L;
+  };
+
+  // Per-thread buffers of the 2D maze routing, kept across nets and
+  // mazeRouteMSMD calls
+  struct MazeScratch
+  {
+    std::vector<float*> src_heap;
+    std::vector<float*> dest_heap;
+    std::vector<int> heap_pos;  // src_heap index of each grid in the heap
+    std::vector<bool> pop_heap2;
+    std::vector<OrderNetEdge> net_eo;
+  };
+
+  // Per-thread cost buffers of the Z pattern routing
+  struct ZRouteCosts
+  {
+    std::vector<float> hvh;       // Horizontal first Z
+    std::vector<float> vhv;       // Vertical first Z
+    std::vector<float> h;         // Horizontal segment cost
+    std::vector<float> v;         // Vertical segment cost
+    std::vector<float> lr;        // Left and right boundary cost
+    std::vector<float> tb;        // Top and bottom boundary cost
+    std::vector<float> hvh_test;  // Vertical first Z
+    std::vector<float> v_test;    // Vertical segment cost
+    std::vector<float> tb_test;   // Top and bottom boundary cost
+  };
+
   int getEdgeCapacity(FrNet* net, int x1, int y1, EdgeDirection direction);
   void getNetId(odb::dbNet* db_net, int& net_id, bool& exists);
   void clearNetRoute(const int netID);
@@ -219,6 +261,21 @@ class FastRouteCore
                      const int via,
                      const int slope,
                      const int L);
+  bool mazeRouteNet(const int netID,
+                    const MazeRouteSettings& settings,
+                    const odb::Rect& net_region,
+                    MazeScratch& scratch,
+                    multi_array<float, 2>& d1,
+                    multi_array<float, 2>& d2);
+  void mazeRouteNetsParallel(const std::vector<int>& net_ids,
+                             const MazeRouteSettings& settings,
+                             multi_array<float, 2>& d1,
+                             multi_array<float, 2>& d2);
+  odb::Rect getMazeNetRegion(const int netID, const int expand);
+  odb::Rect getTreeRegion(const int netID);
+  std::vector<std::vector<int>> getRegionBatches(
+      const std::vector<odb::Rect>& regions);
+  void initMazeScratch(MazeScratch& scratch);
   void convertToMazeroute();
   void updateCongestionHistory(const int upType, bool stopDEC, int& max_adj);
   int getOverflow2D(int* maxOverflow);
@@ -349,6 +406,17 @@ class FastRouteCore
                     const bool genTree,
                     const bool newType,
                     const bool noADJ);
+  void genNetRSMT(const int netID,
+                  const bool congestionDriven,
+                  const bool reRoute,
+                  const bool genTree,
+                  const bool newType,
+                  const bool noADJ,
+                  int& wl,
+                  int& wl1,
+                  int& num_segs,
+                  int& num_shifts);
+  odb::Rect getRSMTNetRegion(const int netID);
   void fluteNormal(const int netID,
                    const std::vector<int>& x,
                    const std::vector<int>& y,
@@ -372,9 +440,10 @@ class FastRouteCore
   void routeLAll(bool firstTime);
   // new functions for tree data structure
   void newrouteL(int netID, RouteType ripuptype, bool viaGuided);
-  void newrouteZ(int netID, int threshold);
-  void newrouteZ_edge(int netID, int edgeID);
+  void newrouteZ(int netID, int threshold, ZRouteCosts& costs);
+  void newrouteZ_edge(int netID, int edgeID, ZRouteCosts& costs);
   void newrouteLAll(bool firstTime, bool viaGuided);
+  void patternRouteNets(const std::function<void(int, int)>& route_net);
   void newrouteZAll(int threshold);
   void routeMonotonicAll(int threshold);
   void routeMonotonic(int netID, int edgeID, int threshold);
@@ -444,7 +513,7 @@ class FastRouteCore
   void StNetOrder();
   bool checkRoute2DTree(int netID);
   void removeLoops();
-  void netedgeOrderDec(int netID);
+  void netedgeOrderDec(int netID, std::vector<OrderNetEdge>& net_eo);
   void printTree2D(int netID);
   void printEdge2D(int netID, int edgeID);
   void printEdge3D(int netID, int edgeID);
@@ -479,6 +548,7 @@ class FastRouteCore
   odb::dbDatabase* db_;
   gui::Gui* gui_;
   int overflow_iterations_;
+  int num_threads_;
   int layer_orientation_;
   int x_range_;
   int y_range_;
@@ -491,7 +561,6 @@ class FastRouteCore
   int x_corner_;
   int y_corner_;
   int tile_size_;
-  int enlarge_;
   int costheight_;
   int ahth_;
   std::vector<int> route_net_ids_;  // IDs of nets to route
@@ -507,15 +576,6 @@ class FastRouteCore
 
   std::vector<short> v_capacity_3D_;
   std::vector<short> h_capacity_3D_;
-  std::vector<float> cost_hvh_;       // Horizontal first Z
-  std::vector<float> cost_vhv_;       // Vertical first Z
-  std::vector<float> cost_h_;         // Horizontal segment cost
-  std::vector<float> cost_v_;         // Vertical segment cost
-  std::vector<float> cost_lr_;        // Left and right boundary cost
-  std::vector<float> cost_tb_;        // Top and bottom boundary cost
-  std::vector<float> cost_hvh_test_;  // Vertical first Z
-  std::vector<float> cost_v_test_;    // Vertical segment cost
-  std::vector<float> cost_tb_test_;   // Top and bottom boundary cost
   std::vector<float> h_cost_table_;
   std::vector<float> v_cost_table_;
   std::vector<int> xcor_;
@@ -524,7 +584,6 @@ class FastRouteCore
 
   std::vector<FrNet*> nets_;
   std::unordered_map<odb::dbNet*, int> db_net_id_map_;  // db net -> net id
-  std::vector<OrderNetEdge> net_eo_;
   std::vector<std::vector<int>>
       gxs_;  // the copy of xs for nets, used for second FLUTE
   std::vector<std::vector<int>>
@@ -535,8 +594,8 @@ class FastRouteCore
   std::vector<OrderNetPin> tree_order_pv_;
   std::vector<OrderTree> tree_order_cong_;
 
-  multi_array<Edge, 2> v_edges_;       // The way it is indexed is (Y, X)
-  multi_array<Edge, 2> h_edges_;       // The way it is indexed is (Y, X)
+  EdgeGrid v_edges_;                   // The way it is indexed is (Y, X)
+  EdgeGrid h_edges_;                   // The way it is indexed is (Y, X)
   multi_array<Edge3D, 3> h_edges_3D_;  // The way it is indexed is (Layer, Y, X)
   multi_array<Edge3D, 3> v_edges_3D_;  // The way it is indexed is (Layer, Y, X)
   multi_array<int, 2> corr_edge_;
@@ -551,6 +610,9 @@ class FastRouteCore
   multi_array<bool, 2> hyper_h_;
   multi_array<bool, 2> in_region_;
 
+  std::vector<MazeScratch> maze_scratch_;
+  std::vector<ZRouteCosts> z_route_costs_;
+
   std::vector<StTree> sttrees_;  // the Steiner trees
   std::vector<StTree> sttrees_bk_;
 
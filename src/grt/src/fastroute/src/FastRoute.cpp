@@ -54,6 +54,7 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
     : max_degree_(0),
       db_(db),
       overflow_iterations_(0),
+      num_threads_(1),
       layer_orientation_(0),
       x_range_(0),
       y_range_(0),
@@ -65,7 +66,6 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       x_corner_(0),
       y_corner_(0),
       tile_size_(0),
-      enlarge_(0),
       costheight_(0),
       ahth_(0),
       num_layers_(0),
@@ -98,8 +98,8 @@ void FastRouteCore::clear()
   total_overflow_ = 0;
   has_2D_overflow_ = false;
 
-  h_edges_.resize(boost::extents[0][0]);
-  v_edges_.resize(boost::extents[0][0]);
+  h_edges_.resize(0, 0);
+  v_edges_.resize(0, 0);
   seglist_.clear();
 
   gxs_.clear();
@@ -117,12 +117,13 @@ void FastRouteCore::clear()
   parent_x3_.resize(boost::extents[0][0]);
   parent_y3_.resize(boost::extents[0][0]);
 
-  net_eo_.clear();
-
   xcor_.clear();
   ycor_.clear();
   dcor_.clear();
 
+  maze_scratch_.clear();
+  z_route_costs_.clear();
+
   hv_.resize(boost::extents[0][0]);
   hyper_v_.resize(boost::extents[0][0]);
   hyper_h_.resize(boost::extents[0][0]);
@@ -136,15 +137,6 @@ void FastRouteCore::clear()
   layer_grid_.resize(boost::extents[0][0]);
   via_link_.resize(boost::extents[0][0]);
 
-  cost_hvh_.clear();
-  cost_vhv_.clear();
-  cost_h_.clear();
-  cost_v_.clear();
-  cost_lr_.clear();
-  cost_tb_.clear();
-  cost_hvh_test_.clear();
-  cost_v_test_.clear();
-  cost_tb_test_.clear();
 
   vertical_blocked_intervals_.clear();
   horizontal_blocked_intervals_.clear();
@@ -194,17 +186,6 @@ void FastRouteCore::setGridsAndLayers(int x, int y, int nLayers)
   corr_edge_.resize(boost::extents[y_range_][x_range_]);
 
   in_region_.resize(boost::extents[y_range_][x_range_]);
-
-  cost_hvh_.resize(x_range_);  // Horizontal first Z
-  cost_vhv_.resize(y_range_);  // Vertical first Z
-  cost_h_.resize(y_range_);    // Horizontal segment cost
-  cost_v_.resize(x_range_);    // Vertical segment cost
-  cost_lr_.resize(y_range_);   // Left and right boundary cost
-  cost_tb_.resize(x_range_);   // Top and bottom boundary cost
-
-  cost_hvh_test_.resize(y_range_);  // Vertical first Z
-  cost_v_test_.resize(x_range_);    // Vertical segment cost
-  cost_tb_test_.resize(x_range_);   // Top and bottom boundary cost
 }
 
 void FastRouteCore::addVCapacity(short verticalCapacity, int layer)
@@ -296,8 +277,8 @@ void FastRouteCore::initEdges()
 
   // allocate memory and initialize for edges
 
-  h_edges_.resize(boost::extents[y_grid_][x_grid_ - 1]);
-  v_edges_.resize(boost::extents[y_grid_ - 1][x_grid_]);
+  h_edges_.resize(y_grid_, x_grid_ - 1);
+  v_edges_.resize(y_grid_ - 1, x_grid_);
 
   v_edges_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
   h_edges_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
@@ -729,7 +710,6 @@ NetRouteMap FastRouteCore::run()
   xcor_.resize(max_degree2);
   ycor_.resize(max_degree2);
   dcor_.resize(max_degree2);
-  net_eo_.reserve(max_degree2);
 
   int THRESH_M = 20;
   const int ENLARGE = 15;  // 5
@@ -1139,7 +1119,6 @@ NetRouteMap FastRouteCore::run()
   }
 
   NetRouteMap routes = getRoutes();
-  net_eo_.clear();
   return routes;
 }
 
@@ -1153,6 +1132,11 @@ void FastRouteCore::setOverflowIterations(int iterations)
   overflow_iterations_ = iterations;
 }
 
+void FastRouteCore::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 std::vector<int> FastRouteCore::getOriginalResources()
 {
   std::vector<int> original_resources(num_layers_);
@@ -31,11 +31,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <algorithm>
+#include <numeric>
 
 #include "AbstractFastRouteRenderer.h"
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -641,156 +643,243 @@ void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
                                  const bool newType,
                                  const bool noADJ)
 {
-  Tree rsmt;
   int numShift = 0;
 
   int wl = 0;
   int wl1 = 0;
   int totalNumSeg = 0;
 
+  std::vector<int> net_ids;
+  for (int i = 0; i < netCount(); i++) {
+    if (!nets_[i]->isRouted()) {
+      net_ids.push_back(i);
+    }
+  }
+
+  // Without reRoute the nets only read the edge usages and are independent.
+  // Otherwise the nets are processed in batches of disjoint regions, which
+  // keeps the result identical to processing them sequentially.
+  std::vector<std::vector<int>> batches;
+  if (reRoute) {
+    std::vector<odb::Rect> net_regions;
+    net_regions.reserve(net_ids.size());
+    for (const int netID : net_ids) {
+      net_regions.push_back(getRSMTNetRegion(netID));
+    }
+    batches = getRegionBatches(net_regions);
+  } else {
+    batches.emplace_back(net_ids.size());
+    std::iota(batches[0].begin(), batches[0].end(), 0);
+  }
+
+  // the Steiner tree visualization is not thread safe
+  const int num_threads = debug_->isOn() ? 1 : num_threads_;
+  for (const std::vector<int>& batch : batches) {
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic) \
+    reduction(+ : wl, wl1, totalNumSeg, numShift)
+    for (int i = 0; i < batch.size(); i++) {
+      try {
+        genNetRSMT(net_ids[batch[i]],
+                   congestionDriven,
+                   reRoute,
+                   genTree,
+                   newType,
+                   noADJ,
+                   wl,
+                   wl1,
+                   totalNumSeg,
+                   numShift);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+  }
+
+  debugPrint(logger_,
+             GRT,
+             "rsmt",
+             1,
+             "Wirelength: {}, Wirelength1: {}\nNumber of segments: {}\nNumber "
+             "of shifts: {}",
+             wl,
+             wl1,
+             totalNumSeg,
+             numShift);
+}
+
+// Generate the Steiner tree of a net and update the segment list and the
+// statistics of gen_brk_RSMT.
+void FastRouteCore::genNetRSMT(const int netID,
+                               const bool congestionDriven,
+                               const bool reRoute,
+                               const bool genTree,
+                               const bool newType,
+                               const bool noADJ,
+                               int& wl,
+                               int& wl1,
+                               int& num_segs,
+                               int& num_shifts)
+{
+  FrNet* net = nets_[netID];
   const int flute_accuracy = 2;
+  Tree rsmt;
 
-  for (int i = 0; i < netCount(); i++) {
-    FrNet* net = nets_[i];
+  float coeffV = 1.36;
 
-    if (net->isRouted())
-      continue;
+  bool cong;
+  if (congestionDriven) {
+    coeffV = coeffADJ(netID);
+    cong = netCongestion(netID);
 
-    float coeffV = 1.36;
+  } else if (HTreeSuite(netID)) {
+    coeffV = 1.2;
+  }
 
-    bool cong;
-    if (congestionDriven) {
-      coeffV = coeffADJ(i);
-      cong = netCongestion(i);
-
-    } else if (HTreeSuite(i)) {
-      coeffV = 1.2;
-    }
-
-    int d = net->getNumPins();
-
-    if (reRoute) {
-      if (newType) {
-        const auto& treeedges = sttrees_[i].edges;
-        const auto& treenodes = sttrees_[i].nodes;
-        for (int j = 0; j < sttrees_[i].num_edges(); j++) {
-          // only route the non-degraded edges (len>0)
-          if (sttrees_[i].edges[j].len > 0) {
-            const TreeEdge* treeedge = &(treeedges[j]);
-            const int n1 = treeedge->n1;
-            const int n2 = treeedge->n2;
-            const int x1 = treenodes[n1].x;
-            const int y1 = treenodes[n1].y;
-            const int x2 = treenodes[n2].x;
-            const int y2 = treenodes[n2].y;
-            newRipup(treeedge, x1, y1, x2, y2, i);
-          }
-        }
-      } else {
-        // remove the est_usage due to the segments in this net
-        for (auto& seg : seglist_[i]) {
-          ripupSegL(&seg);
+  int d = net->getNumPins();
+
+  if (reRoute) {
+    if (newType) {
+      const auto& treeedges = sttrees_[netID].edges;
+      const auto& treenodes = sttrees_[netID].nodes;
+      for (int j = 0; j < sttrees_[netID].num_edges(); j++) {
+        // only route the non-degraded edges (len>0)
+        if (sttrees_[netID].edges[j].len > 0) {
+          const TreeEdge* treeedge = &(treeedges[j]);
+          const int n1 = treeedge->n1;
+          const int n2 = treeedge->n2;
+          const int x1 = treenodes[n1].x;
+          const int y1 = treenodes[n1].y;
+          const int x2 = treenodes[n2].x;
+          const int y2 = treenodes[n2].y;
+          newRipup(treeedge, x1, y1, x2, y2, netID);
         }
       }
+    } else {
+      // remove the est_usage due to the segments in this net
+      for (auto& seg : seglist_[netID]) {
+        ripupSegL(&seg);
+      }
     }
+  }
 
-    if (noADJ) {
-      coeffV = 1.2;
-    }
+  if (noADJ) {
+    coeffV = 1.2;
+  }
 
-    // check net alpha because FastRoute has a special implementation of flute
-    // TODO: move this flute implementation to SteinerTreeBuilder
-    const float net_alpha = stt_builder_->getAlpha(net->getDbNet());
-    if (net_alpha > 0.0) {
-      rsmt = stt_builder_->makeSteinerTree(
-          net->getDbNet(), net->getPinX(), net->getPinY(), net->getDriverIdx());
-    } else {
-      if (congestionDriven) {
-        // call congestion driven flute to generate RSMT
-        if (cong) {
-          fluteCongest(
-              i, net->getPinX(), net->getPinY(), flute_accuracy, coeffV, rsmt);
-        } else {
-          fluteNormal(
-              i, net->getPinX(), net->getPinY(), flute_accuracy, coeffV, rsmt);
-        }
-        if (d > 3) {
-          numShift += edgeShiftNew(rsmt, i);
-        }
+  // check net alpha because FastRoute has a special implementation of flute
+  // TODO: move this flute implementation to SteinerTreeBuilder
+  const float net_alpha = stt_builder_->getAlpha(net->getDbNet());
+  if (net_alpha > 0.0) {
+    rsmt = stt_builder_->makeSteinerTree(
+        net->getDbNet(), net->getPinX(), net->getPinY(), net->getDriverIdx());
+  } else {
+    if (congestionDriven) {
+      // call congestion driven flute to generate RSMT
+      if (cong) {
+        fluteCongest(netID,
+                     net->getPinX(),
+                     net->getPinY(),
+                     flute_accuracy,
+                     coeffV,
+                     rsmt);
       } else {
-        // call FLUTE to generate RSMT for each net
-        fluteNormal(
-            i, net->getPinX(), net->getPinY(), flute_accuracy, coeffV, rsmt);
+        fluteNormal(netID,
+                    net->getPinX(),
+                    net->getPinY(),
+                    flute_accuracy,
+                    coeffV,
+                    rsmt);
       }
+      if (d > 3) {
+        num_shifts += edgeShiftNew(rsmt, netID);
+      }
+    } else {
+      // call FLUTE to generate RSMT for each net
+      fluteNormal(
+          netID, net->getPinX(), net->getPinY(), flute_accuracy, coeffV, rsmt);
     }
-    if (debug_->isOn() && debug_->steinerTree_
-        && net->getDbNet() == debug_->net_) {
-      steinerTreeVisualization(rsmt, net);
-    }
+  }
+  if (debug_->isOn() && debug_->steinerTree_
+      && net->getDbNet() == debug_->net_) {
+    steinerTreeVisualization(rsmt, net);
+  }
 
-    if (genTree) {
-      copyStTree(i, rsmt);
-    }
+  if (genTree) {
+    copyStTree(netID, rsmt);
+  }
 
-    if (net->getNumPins() != rsmt.deg) {
-      d = rsmt.deg;
-    }
+  if (net->getNumPins() != rsmt.deg) {
+    d = rsmt.deg;
+  }
 
-    if (congestionDriven) {
-      for (int j = 0; j < sttrees_[i].num_edges(); j++)
-        wl1 += sttrees_[i].edges[j].len;
-    }
-
-    for (int j = 0; j < rsmt.branchCount(); j++) {
-      const int x1 = rsmt.branch[j].x;
-      const int y1 = rsmt.branch[j].y;
-      const int n = rsmt.branch[j].n;
-      const int x2 = rsmt.branch[n].x;
-      const int y2 = rsmt.branch[n].y;
-
-      wl += abs(x1 - x2) + abs(y1 - y2);
-
-      if (x1 != x2 || y1 != y2) {  // the branch is not degraded (a point)
-        // the position of this segment in seglist
-        seglist_[i].push_back(Segment());
-        auto& seg = seglist_[i].back();
-        if (x1 < x2) {
-          seg.x1 = x1;
-          seg.x2 = x2;
-          seg.y1 = y1;
-          seg.y2 = y2;
-        } else {
-          seg.x1 = x2;
-          seg.x2 = x1;
-          seg.y1 = y2;
-          seg.y2 = y1;
-        }
+  if (congestionDriven) {
+    for (int j = 0; j < sttrees_[netID].num_edges(); j++)
+      wl1 += sttrees_[netID].edges[j].len;
+  }
 
-        seg.netID = i;
-      }
-    }  // loop j
+  for (int j = 0; j < rsmt.branchCount(); j++) {
+    const int x1 = rsmt.branch[j].x;
+    const int y1 = rsmt.branch[j].y;
+    const int n = rsmt.branch[j].n;
+    const int x2 = rsmt.branch[n].x;
+    const int y2 = rsmt.branch[n].y;
+
+    wl += abs(x1 - x2) + abs(y1 - y2);
 
-    totalNumSeg += seglist_[i].size();
+    if (x1 != x2 || y1 != y2) {  // the branch is not degraded (a point)
+      // the position of this segment in seglist
+      seglist_[netID].push_back(Segment());
+      auto& seg = seglist_[netID].back();
+      if (x1 < x2) {
+        seg.x1 = x1;
+        seg.x2 = x2;
+        seg.y1 = y1;
+        seg.y2 = y2;
+      } else {
+        seg.x1 = x2;
+        seg.x2 = x1;
+        seg.y1 = y2;
+        seg.y2 = y1;
+      }
 
-    if (reRoute) {
-      // update the est_usage due to the segments in this net
-      newrouteL(
-          i,
-          RouteType::NoRoute,
-          true);  // route the net with no previous route for each tree edge
+      seg.netID = netID;
     }
-  }  // loop i
+  }  // loop j
 
-  debugPrint(logger_,
-             GRT,
-             "rsmt",
-             1,
-             "Wirelength: {}, Wirelength1: {}\nNumber of segments: {}\nNumber "
-             "of shifts: {}",
-             wl,
-             wl1,
-             totalNumSeg,
-             numShift);
+  num_segs += seglist_[netID].size();
+
+  if (reRoute) {
+    // update the est_usage due to the segments in this net
+    newrouteL(
+        netID,
+        RouteType::NoRoute,
+        true);  // route the net with no previous route for each tree edge
+  }
+}
+
+// The region of the edges gen_brk_RSMT reads and updates for a net: the
+// bounding box of its pins, its current tree and its segments. The new tree
+// stays in the bounding box of the pins.
+odb::Rect FastRouteCore::getRSMTNetRegion(const int netID)
+{
+  const FrNet* net = nets_[netID];
+  odb::Rect region;
+  region.mergeInit();
+  for (int p = 0; p < net->getNumPins(); p++) {
+    const int x = net->getPinX()[p];
+    const int y = net->getPinY()[p];
+    region.merge(odb::Rect(x, y, x, y));
+  }
+  if (sttrees_[netID].num_nodes > 0) {
+    region.merge(getTreeRegion(netID));
+  }
+  for (const Segment& seg : seglist_[netID]) {
+    region.merge(odb::Rect(seg.x1, seg.y1, seg.x2, seg.y2));
+  }
+
+  return region;
 }
 
 }  // namespace grt
@@ -460,7 +460,6 @@ void FastRouteCore::releaseNetResources(const int netID)
       const std::vector<short>& gridsY = treeedge->route.gridsY;
       const std::vector<short>& gridsL = treeedge->route.gridsL;
       const int routeLen = treeedge->route.routelen;
-      Edge* edge;
       Edge3D* edge_3D;
 
       for (int i = 0; i < routeLen; i++) {
@@ -468,15 +467,13 @@ void FastRouteCore::releaseNetResources(const int netID)
           continue;
         else if (gridsX[i] == gridsX[i + 1]) {  // a vertical edge
           const int ymin = std::min(gridsY[i], gridsY[i + 1]);
-          edge = &v_edges_[ymin][gridsX[i]];
           edge_3D = &v_edges_3D_[gridsL[i]][ymin][gridsX[i]];
-          edge->usage -= edgeCost;
+          v_edges_[ymin][gridsX[i]].usage -= edgeCost;
           edge_3D->usage -= edgeCost;
         } else if (gridsY[i] == gridsY[i + 1]) {  // a horizontal edge
           const int xmin = std::min(gridsX[i], gridsX[i + 1]);
-          edge = &h_edges_[gridsY[i]][xmin];
           edge_3D = &h_edges_3D_[gridsL[i]][gridsY[i]][xmin];
-          edge->usage -= edgeCost;
+          h_edges_[gridsY[i]][xmin].usage -= edgeCost;
           edge_3D->usage -= edgeCost;
         }
       }
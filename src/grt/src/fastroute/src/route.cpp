@@ -30,12 +30,16 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <omp.h>
+
 #include <algorithm>
+#include <functional>
 #include <queue>
 
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -386,20 +390,43 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
 // first
 void FastRouteCore::newrouteLAll(bool firstTime, bool viaGuided)
 {
-  if (firstTime) {
-    for (int i = 0; i < netCount(); i++) {
-      if (!nets_[i]->isRouted())
-        newrouteL(i, RouteType::NoRoute, viaGuided);  // do L-routing
+  const RouteType ripup_type
+      = firstTime ? RouteType::NoRoute : RouteType::LRoute;
+  patternRouteNets([&](const int netID, const int) {
+    newrouteL(netID, ripup_type, viaGuided);  // do L-routing
+  });
+}
+
+// Pattern route the unrouted nets with route_net(netID, thread). A net only
+// touches the edges inside the bounding box of its tree, so the nets are
+// routed in parallel in batches of disjoint tree regions.
+void FastRouteCore::patternRouteNets(
+    const std::function<void(int, int)>& route_net)
+{
+  std::vector<int> net_ids;
+  std::vector<odb::Rect> net_regions;
+  for (int i = 0; i < netCount(); i++) {
+    if (!nets_[i]->isRouted()) {
+      net_ids.push_back(i);
+      net_regions.push_back(getTreeRegion(i));
     }
-  } else {
-    for (int i = 0; i < netCount(); i++) {
-      if (!nets_[i]->isRouted())
-        newrouteL(i, RouteType::LRoute, viaGuided);
+  }
+
+  for (const std::vector<int>& batch : getRegionBatches(net_regions)) {
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int i = 0; i < batch.size(); i++) {
+      try {
+        route_net(net_ids[batch[i]], omp_get_thread_num());
+      } catch (...) {
+        exception.capture();
+      }
     }
+    exception.rethrow();
   }
 }
 
-void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
+void FastRouteCore::newrouteZ_edge(int netID, int edgeID, ZRouteCosts& costs)
 {
   const int edgeCost = nets_[netID]->getEdgeCost();
 
@@ -440,13 +467,13 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   // compute the cost for all Z routing
 
   for (int i = 0; i <= segWidth; i++) {
-    cost_hvh_[i] = 0;
-    cost_v_[i] = 0;
-    cost_tb_[i] = 0;
+    costs.hvh[i] = 0;
+    costs.v[i] = 0;
+    costs.tb[i] = 0;
 
-    cost_hvh_test_[i] = 0;
-    cost_v_test_[i] = 0;
-    cost_tb_test_[i] = 0;
+    costs.hvh_test[i] = 0;
+    costs.v_test[i] = 0;
+    costs.tb_test[i] = 0;
   }
 
   // compute the cost for all H-segs and V-segs and partial boundary seg
@@ -455,10 +482,10 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
     for (int j = ymin; j < ymax; j++) {
       const float tmp = v_edges_[j][i].est_usage_red() - v_capacity_lb_;
       if (tmp > 0) {
-        cost_v_[i - x1] += tmp;
-        cost_v_test_[i - x1] += HCOST;
+        costs.v[i - x1] += tmp;
+        costs.v_test[i - x1] += HCOST;
       } else {
-        cost_v_test_[i - x1] += tmp;
+        costs.v_test[i - x1] += tmp;
       }
     }
   }
@@ -466,29 +493,29 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   for (int j = x1; j < x2; j++) {
     const float tmp = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
     if (tmp > 0) {
-      cost_tb_[0] += tmp;
-      cost_tb_test_[0] += HCOST;
+      costs.tb[0] += tmp;
+      costs.tb_test[0] += HCOST;
     } else {
-      cost_tb_test_[0] += tmp;
+      costs.tb_test[0] += tmp;
     }
   }
   for (int i = 1; i <= segWidth; i++) {
-    cost_tb_[i] = cost_tb_[i - 1];
+    costs.tb[i] = costs.tb[i - 1];
     const float tmp1
         = h_edges_[y1][x1 + i - 1].est_usage_red() - h_capacity_lb_;
     if (tmp1 > 0) {
-      cost_tb_[i] += tmp1;
-      cost_tb_test_[i] += HCOST;
+      costs.tb[i] += tmp1;
+      costs.tb_test[i] += HCOST;
     } else {
-      cost_tb_test_[i] += tmp1;
+      costs.tb_test[i] += tmp1;
     }
     const float tmp2
         = h_edges_[y2][x1 + i - 1].est_usage_red() - h_capacity_lb_;
     if (tmp2 > 0) {
-      cost_tb_[i] -= tmp2;
-      cost_tb_test_[i] -= HCOST;
+      costs.tb[i] -= tmp2;
+      costs.tb_test[i] -= HCOST;
     } else {
-      cost_tb_test_[i] -= tmp2;
+      costs.tb_test[i] -= tmp2;
     }
   }
   // compute cost for all Z routing
@@ -496,15 +523,15 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   float btTEST = BIG_INT;
   int bestZ = 0;
   for (int i = 0; i <= segWidth; i++) {
-    cost_hvh_[i] = cost_v_[i] + cost_tb_[i];
-    cost_hvh_test_[i] = cost_v_test_[i] + cost_tb_test_[i];
-    if (cost_hvh_[i] < bestcost) {
-      bestcost = cost_hvh_[i];
-      btTEST = cost_hvh_test_[i];
+    costs.hvh[i] = costs.v[i] + costs.tb[i];
+    costs.hvh_test[i] = costs.v_test[i] + costs.tb_test[i];
+    if (costs.hvh[i] < bestcost) {
+      bestcost = costs.hvh[i];
+      btTEST = costs.hvh_test[i];
       bestZ = i + x1;
-    } else if (cost_hvh_[i] == bestcost) {
-      if (cost_hvh_test_[i] < btTEST) {
-        btTEST = cost_hvh_test_[i];
+    } else if (costs.hvh[i] == bestcost) {
+      if (costs.hvh_test[i] < btTEST) {
+        btTEST = costs.hvh_test[i];
         bestZ = i + x1;
       }
     }
@@ -524,7 +551,7 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
 }
 
 // Z-route, rip-up the previous route according to the ripuptype
-void FastRouteCore::newrouteZ(int netID, int threshold)
+void FastRouteCore::newrouteZ(int netID, int threshold, ZRouteCosts& costs)
 {
   const int edgeCost = nets_[netID]->getEdgeCost();
 
@@ -584,52 +611,52 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
 
         if (status1 == 0 || status1 == 3) {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] = 0;
-            cost_hvh_test_[i] = 0;
+            costs.hvh[i] = 0;
+            costs.hvh_test[i] = 0;
           }
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] = 0;
+            costs.vhv[i] = 0;
           }
         } else if (status1 == 2) {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] = 0;
-            cost_hvh_test_[i] = 0;
+            costs.hvh[i] = 0;
+            costs.hvh_test[i] = 0;
           }
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] = via_cost_;
+            costs.vhv[i] = via_cost_;
           }
         } else {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] = via_cost_;
-            cost_hvh_test_[i] = via_cost_;
+            costs.hvh[i] = via_cost_;
+            costs.hvh_test[i] = via_cost_;
           }
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] = 0;
+            costs.vhv[i] = 0;
           }
         }
 
         if (status2 == 2) {
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] += via_cost_;
+            costs.vhv[i] += via_cost_;
           }
 
         } else if (status2 == 1) {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] += via_cost_;
-            cost_hvh_test_[i] += via_cost_;
+            costs.hvh[i] += via_cost_;
+            costs.hvh_test[i] += via_cost_;
           }
         }
 
         for (int i = 0; i < segWidth; i++) {
-          cost_v_[i] = 0;
-          cost_tb_[i] = 0;
+          costs.v[i] = 0;
+          costs.tb[i] = 0;
 
-          cost_v_test_[i] = 0;
-          cost_tb_test_[i] = 0;
+          costs.v_test[i] = 0;
+          costs.tb_test[i] = 0;
         }
         for (int i = 0; i < segHeight; i++) {
-          cost_h_[i] = 0;
-          cost_lr_[i] = 0;
+          costs.h[i] = 0;
+          costs.lr[i] = 0;
         }
 
         // compute the cost for all H-segs and V-segs and partial boundary seg
@@ -638,10 +665,10 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           for (int j = ymin; j < ymax; j++) {
             const float tmp = v_edges_[j][i].est_usage_red() - v_capacity_lb_;
             if (tmp > 0) {
-              cost_v_[i - x1] += tmp;
-              cost_v_test_[i - x1] += HCOST;
+              costs.v[i - x1] += tmp;
+              costs.v_test[i - x1] += HCOST;
             } else {
-              cost_v_test_[i - x1] += tmp;
+              costs.v_test[i - x1] += tmp;
             }
           }
         }
@@ -649,29 +676,29 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         for (int j = x1; j < x2; j++) {
           const float tmp = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
           if (tmp > 0) {
-            cost_tb_[0] += tmp;
-            cost_tb_test_[0] += HCOST;
+            costs.tb[0] += tmp;
+            costs.tb_test[0] += HCOST;
           } else {
-            cost_tb_test_[0] += tmp;
+            costs.tb_test[0] += tmp;
           }
         }
         for (int i = 1; i < segWidth; i++) {
-          cost_tb_[i] = cost_tb_[i - 1];
+          costs.tb[i] = costs.tb[i - 1];
           const float tmp1
               = h_edges_[y1][x1 + i - 1].est_usage_red() - h_capacity_lb_;
           if (tmp1 > 0) {
-            cost_tb_[i] += tmp1;
-            cost_tb_test_[0] += HCOST;
+            costs.tb[i] += tmp1;
+            costs.tb_test[0] += HCOST;
           } else {
-            cost_tb_test_[0] += tmp1;
+            costs.tb_test[0] += tmp1;
           }
           const float tmp2
               = h_edges_[y2][x1 + i - 1].est_usage_red() - h_capacity_lb_;
           if (tmp2 > 0) {
-            cost_tb_[i] -= tmp2;
-            cost_tb_test_[0] -= HCOST;
+            costs.tb[i] -= tmp2;
+            costs.tb_test[0] -= HCOST;
           } else {
-            cost_tb_test_[0] -= tmp2;
+            costs.tb_test[0] -= tmp2;
           }
         }
         // cost for H-segs
@@ -679,7 +706,7 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           for (int j = x1; j < x2; j++) {
             const float tmp = h_edges_[i][j].est_usage_red() - h_capacity_lb_;
             if (tmp > 0)
-              cost_h_[i - ymin] += tmp;
+              costs.h[i - ymin] += tmp;
           }
         }
         // cost for Left&Right boundary segs (form Z with H-seg)
@@ -687,35 +714,35 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           for (int j = y1; j < y2; j++) {
             const float tmp = v_edges_[j][x2].est_usage_red() - v_capacity_lb_;
             if (tmp > 0)
-              cost_lr_[0] += tmp;
+              costs.lr[0] += tmp;
           }
           for (int i = 1; i < segHeight; i++) {
-            cost_lr_[i] = cost_lr_[i - 1];
+            costs.lr[i] = costs.lr[i - 1];
             const float tmp1
                 = v_edges_[y1 + i - 1][x1].est_usage_red() - v_capacity_lb_;
             if (tmp1 > 0)
-              cost_lr_[i] += tmp1;
+              costs.lr[i] += tmp1;
             const float tmp2
                 = v_edges_[y1 + i - 1][x2].est_usage_red() - v_capacity_lb_;
             if (tmp2 > 0)
-              cost_lr_[i] -= tmp2;
+              costs.lr[i] -= tmp2;
           }
         } else {
           for (int j = y2; j < y1; j++) {
             const float tmp = v_edges_[j][x1].est_usage - v_capacity_lb_;
             if (tmp > 0)
-              cost_lr_[0] += tmp;
+              costs.lr[0] += tmp;
           }
           for (int i = 1; i < segHeight; i++) {
-            cost_lr_[i] = cost_lr_[i - 1];
+            costs.lr[i] = costs.lr[i - 1];
             const float tmp1
                 = v_edges_[y2 + i - 1][x2].est_usage_red() - v_capacity_lb_;
             if (tmp1 > 0)
-              cost_lr_[i] += tmp1;
+              costs.lr[i] += tmp1;
             const float tmp2
                 = v_edges_[y2 + i - 1][x1].est_usage_red() - v_capacity_lb_;
             if (tmp2 > 0)
-              cost_lr_[i] -= tmp2;
+              costs.lr[i] -= tmp2;
           }
         }
 
@@ -725,22 +752,22 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         float btTEST = BIG_INT;
         int bestZ = 0;
         for (int i = 0; i < segWidth; i++) {
-          cost_hvh_[i] += cost_v_[i] + cost_tb_[i];
-          if (cost_hvh_[i] < bestcost) {
-            bestcost = cost_hvh_[i];
-            btTEST = cost_hvh_test_[i];
+          costs.hvh[i] += costs.v[i] + costs.tb[i];
+          if (costs.hvh[i] < bestcost) {
+            bestcost = costs.hvh[i];
+            btTEST = costs.hvh_test[i];
             bestZ = i + x1;
-          } else if (cost_hvh_[i] == bestcost) {
-            if (cost_hvh_test_[i] < btTEST) {
-              btTEST = cost_hvh_test_[i];
+          } else if (costs.hvh[i] == bestcost) {
+            if (costs.hvh_test[i] < btTEST) {
+              btTEST = costs.hvh_test[i];
               bestZ = i + x1;
             }
           }
         }
         for (int i = 0; i < segHeight; i++) {
-          cost_vhv_[i] += cost_h_[i] + cost_lr_[i];
-          if (cost_vhv_[i] < bestcost) {
-            bestcost = cost_vhv_[i];
+          costs.vhv[i] += costs.h[i] + costs.lr[i];
+          if (costs.vhv[i] < bestcost) {
+            bestcost = costs.vhv[i];
             bestZ = i + ymin;
             HVH = false;
           }
@@ -805,11 +832,11 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           }
         }
       } else if (num_terminals == 2) {
-        newrouteZ_edge(netID, ind);
+        newrouteZ_edge(netID, ind, costs);
       }
     } else if (num_terminals == 2 && sttrees_[netID].edges[ind].len > threshold
                && threshold > 4) {
-      newrouteZ_edge(netID, ind);
+      newrouteZ_edge(netID, ind, costs);
     }
   }
 }
@@ -819,10 +846,23 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
 // first
 void FastRouteCore::newrouteZAll(int threshold)
 {
-  for (int i = 0; i < netCount(); i++) {
-    if (!nets_[i]->isRouted())
-      newrouteZ(i, threshold);  // ripup previous route and do Z-routing
+  z_route_costs_.resize(std::max(num_threads_, 1));
+  for (ZRouteCosts& costs : z_route_costs_) {
+    costs.hvh.resize(x_range_);
+    costs.vhv.resize(y_range_);
+    costs.h.resize(y_range_);
+    costs.v.resize(x_range_);
+    costs.lr.resize(y_range_);
+    costs.tb.resize(x_range_);
+    costs.hvh_test.resize(y_range_);
+    costs.v_test.resize(x_range_);
+    costs.tb_test.resize(x_range_);
   }
+
+  patternRouteNets([&](const int netID, const int thread) {
+    // ripup previous route and do Z-routing
+    newrouteZ(netID, threshold, z_route_costs_[thread]);
+  });
 }
 
 // Ripup the original route and do Monotonic routing within bounding box
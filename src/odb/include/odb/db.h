@@ -357,11 +357,21 @@ class dbDatabase : public dbObject
   ///
   void read(std::ifstream& f);
 
+  ///
+  /// Read a database from this file. The file is memory mapped, so the
+  /// sections of the database are parsed concurrently straight from the
+  /// mapping instead of being read into memory first.
+  /// WARNING: This function destroys the data currently in the database.
+  /// Throws ZIOError..
+  ///
+  void read(const char* file_name);
+
   ///
   /// Write a database to this stream.
+  /// If compress is true, the sections of the database are compressed.
   /// Throws ZIOError..
   ///
-  void write(FILE* file);
+  void write(FILE* file, bool compress = false);
 
   /// Throws ZIOError..
   void writeTech(FILE* file);
@@ -36,7 +36,9 @@
 
 #include <array>
 #include <fstream>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "ZException.h"
 #include "dbObject.h"
@@ -50,10 +52,19 @@ class _dbDatabase;
 
 class dbOStream
 {
+  struct SectionWriter;
+
   _dbDatabase* _db;
-  FILE* _f;
+  FILE* _f;  // null for a section held in memory
   double _lef_area_factor;
   double _lef_dist_factor;
+  std::vector<char>* _section;
+  bool _compress;
+  // A section of writeSections is held in memory until it is its turn to be
+  // written.  From then on it writes to the output of its parent directly.
+  SectionWriter* _writer;
+  size_t _index;
+  size_t _flush_size;  // size of _section at which the turn is checked
 
   void write_error()
   {
@@ -61,11 +72,49 @@ class dbOStream
                      strerror(ferror(_f)));
   }
 
+  void write(const void* c, size_t n)
+  {
+    if (_f) {
+      if (fwrite(c, n, 1, _f) != 1)
+        write_error();
+    } else {
+      const char* p = static_cast<const char*>(c);
+      _section->insert(_section->end(), p, p + n);
+      if (_section->size() >= _flush_size) {
+        flushSection();
+      }
+    }
+  }
+
+  // Position in the output, -1 if it is unknown.
+  long position() { return _f ? ftell(_f) : (long) _section->size(); }
+
+  void flushSection();
+  void startWriting();
+
+  // Stream into one section, shares the settings of parent.
+  dbOStream(const dbOStream& parent,
+            std::vector<char>& section,
+            SectionWriter* writer,
+            size_t index);
+
  public:
+  using Section = std::function<void(dbOStream&)>;
+
   dbOStream(_dbDatabase* db, FILE* f);
 
   _dbDatabase* getDatabase() { return _db; }
 
+  // Compress the sections written by writeSections.
+  void setCompress(bool compress) { _compress = compress; }
+
+  // Each section is serialized by its own thread, at most one per core.  The
+  // sections are written in order behind an index of their sizes so they can
+  // be read back concurrently by dbIStream::readSections.  Only the sections
+  // ahead of the one being written are held in memory, the index is filled
+  // in at the end.  Compressed sections are held in memory until compressed.
+  void writeSections(const std::vector<Section>& sections);
+
   dbOStream& operator<<(bool c)
   {
     unsigned char b = (c == true ? 1 : 0);
@@ -74,89 +123,67 @@ class dbOStream
 
   dbOStream& operator<<(char c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(unsigned char c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(short c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(unsigned short c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(int c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(uint64_t c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(unsigned int c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(int8_t c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(float c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(double c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(long double c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
@@ -167,9 +194,7 @@ class dbOStream
     } else {
       int l = strlen(c) + 1;
       *this << l;
-      int n = fwrite(c, l, 1, _f);
-      if (n != 1)
-        write_error();
+      write(c, l);
     }
 
     return *this;
@@ -177,9 +202,7 @@ class dbOStream
 
   dbOStream& operator<<(dbObjectType c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1)
-      write_error();
+    write(&c, sizeof(c));
     return *this;
   }
 
@@ -238,16 +261,52 @@ class dbOStream
 
 class dbIStream
 {
-  std::ifstream& _f;
+  std::ifstream* _f;  // null for a section held in memory
   _dbDatabase* _db;
   double _lef_area_factor;
   double _lef_dist_factor;
+  // The file is read in large chunks and the fields are copied out of the
+  // buffer instead of going through an ifstream::read call for each field.
+  // The unread part of the buffer is given back to the file on destruction
+  // so another stream can continue from the same position.
+  std::vector<char> _buffer;
+  const char* _data;  // _buffer, or the data of a section held in memory
+  size_t _pos;
+  size_t _size;
+  std::streamoff _remaining;  // bytes of the file after the buffer
+
+  void initFactors();
+  void readSlow(char* c, size_t n);
+
+  void read(char* c, size_t n)
+  {
+    if (_size - _pos >= n) {
+      memcpy(c, _data + _pos, n);
+      _pos += n;
+    } else {
+      readSlow(c, n);
+    }
+  }
+
+  // Stream over one section in memory, shares the settings of parent.
+  dbIStream(const dbIStream& parent, const char* data, size_t size);
 
  public:
+  using Section = std::function<void(dbIStream&)>;
+
   dbIStream(_dbDatabase* db, std::ifstream& f);
+  // Stream over a file mapped in memory.
+  dbIStream(_dbDatabase* db, const char* data, size_t size);
+  ~dbIStream();
 
   _dbDatabase* getDatabase() { return _db; }
 
+  // Reads sections written by dbOStream::writeSections and parses them
+  // concurrently.  The sections must be given in the order they were written.
+  // Sections of a mapped file and sections nested in a section are parsed
+  // in place, not copied.
+  void readSections(const std::vector<Section>& sections);
+
   dbIStream& operator>>(bool& c)
   {
     unsigned char b;
@@ -258,67 +317,67 @@ class dbIStream
 
   dbIStream& operator>>(char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(short& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned short& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(uint64_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int8_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(float& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(long double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
@@ -331,7 +390,7 @@ class dbIStream
       c = NULL;
     else {
       c = (char*) malloc(l);
-      _f.read(reinterpret_cast<char*>(c), l);
+      read(c, l);
     }
 
     return *this;
@@ -339,7 +398,7 @@ class dbIStream
 
   dbIStream& operator>>(dbObjectType& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
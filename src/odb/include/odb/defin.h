@@ -72,6 +72,8 @@ class defin
   void continueOnErrors();
   void namesAreDBIDs();
   void setAssemblyMode();
+  /// Encode the wires of NETS on this many threads.
+  void setThreads(int threads);
   void useBlockName(const char* name);
 
   /// Create a new chip
@@ -35,6 +35,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 
 #include "array1.h"
 #include "utl/Logger.h"
@@ -48,6 +49,17 @@ class Ath__parser
   ~Ath__parser();
   void openFile(char* name = nullptr);
   void setInputFP(FILE* fp);
+  // Take the lines from words already split in memory instead of reading
+  // the input file.  Line ii has the words from words[lineStarts[ii]] up to
+  // words[lineStarts[ii + 1]] and is line lineNums[ii] of the file.  When
+  // the lines run out nextInput is called to set the next ones, it returns
+  // false at the end of the input.  Pass nullptr words to read the file
+  // again.
+  void setInputWords(char** words,
+                     const int* lineStarts,
+                     const int* lineNums,
+                     int lineCnt);
+  void setNextInput(std::function<bool()> nextInput);
   int mkWords(const char* word, const char* sep = nullptr);
   int readLineAndBreak(int prevWordCnt = -1);
   int parseNextLine();
@@ -83,6 +95,7 @@ class Ath__parser
   char* _tmpLine;
   char* _wordSeparators;
   char** _wordArray;
+  char** _words;  // _wordArray or the current line of _inputWords
   char _commentChar;
   int _maxWordCnt;
 
@@ -92,6 +105,13 @@ class Ath__parser
   FILE* _inFP;
   char* _inputFile;
 
+  char** _inputWords;
+  const int* _inputLineStarts;
+  const int* _inputLineNums;
+  int _inputLineCnt;
+  int _inputLine;
+  std::function<bool()> _nextInput;
+
   int _progressLineChunk;
   utl::Logger* _logger;
 };
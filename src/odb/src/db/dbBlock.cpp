@@ -920,47 +920,68 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
     stream << block._children;
 
   stream << block._currentCcAdjOrder;
-  stream << *block._bterm_tbl;
-  stream << *block._iterm_tbl;
-  stream << *block._net_tbl;
-  stream << *block._inst_hdr_tbl;
-  stream << *block._inst_tbl;
-  stream << *block._module_tbl;
-  stream << *block._modinst_tbl;
-  stream << *block._powerdomain_tbl;
-  stream << *block._logicport_tbl;
-  stream << *block._powerswitch_tbl;
-  stream << *block._isolation_tbl;
-  stream << *block._group_tbl;
-  stream << *block.ap_tbl_;
-  stream << *block.global_connect_tbl_;
-  stream << *block._guide_tbl;
-  stream << *block._net_tracks_tbl;
-  stream << *block._box_tbl;
-  stream << *block._via_tbl;
-  stream << *block._gcell_grid_tbl;
-  stream << *block._track_grid_tbl;
-  stream << *block._obstruction_tbl;
-  stream << *block._blockage_tbl;
-  stream << *block._wire_tbl;
-  stream << *block._swire_tbl;
-  stream << *block._sbox_tbl;
-  stream << *block._row_tbl;
-  stream << *block._fill_tbl;
-  stream << *block._region_tbl;
-  stream << *block._hier_tbl;
-  stream << *block._bpin_tbl;
-  stream << *block._non_default_rule_tbl;
-  stream << *block._layer_rule_tbl;
-  stream << *block._prop_tbl;
-  stream << *block._name_cache;
-  stream << *block._r_val_tbl;
-  stream << *block._c_val_tbl;
-  stream << *block._cc_val_tbl;
-  stream << *block._cap_node_tbl;  // DKF - 2/21/05
-  stream << *block._r_seg_tbl;     // DKF - 2/21/05
-  stream << *block._cc_seg_tbl;
-  stream << *block._extControl;
+  // The tables are grouped into sections that are streamed concurrently.
+  stream.writeSections({
+      [&block](dbOStream& s) {
+        s << *block._bterm_tbl;
+        s << *block._iterm_tbl;
+      },
+      [&block](dbOStream& s) { s << *block._net_tbl; },
+      [&block](dbOStream& s) {
+        s << *block._inst_hdr_tbl;
+        s << *block._inst_tbl;
+      },
+      [&block](dbOStream& s) {
+        s << *block._module_tbl;
+        s << *block._modinst_tbl;
+        s << *block._powerdomain_tbl;
+        s << *block._logicport_tbl;
+        s << *block._powerswitch_tbl;
+        s << *block._isolation_tbl;
+        s << *block._group_tbl;
+        s << *block.ap_tbl_;
+        s << *block.global_connect_tbl_;
+      },
+      [&block](dbOStream& s) {
+        s << *block._guide_tbl;
+        s << *block._net_tracks_tbl;
+      },
+      [&block](dbOStream& s) { s << *block._box_tbl; },
+      [&block](dbOStream& s) {
+        s << *block._via_tbl;
+        s << *block._gcell_grid_tbl;
+        s << *block._track_grid_tbl;
+        s << *block._obstruction_tbl;
+        s << *block._blockage_tbl;
+      },
+      [&block](dbOStream& s) { s << *block._wire_tbl; },
+      [&block](dbOStream& s) {
+        s << *block._swire_tbl;
+        s << *block._sbox_tbl;
+      },
+      [&block](dbOStream& s) {
+        s << *block._row_tbl;
+        s << *block._fill_tbl;
+        s << *block._region_tbl;
+        s << *block._hier_tbl;
+        s << *block._bpin_tbl;
+        s << *block._non_default_rule_tbl;
+        s << *block._layer_rule_tbl;
+        s << *block._prop_tbl;
+      },
+      [&block](dbOStream& s) { s << *block._name_cache; },
+      [&block](dbOStream& s) {
+        s << *block._r_val_tbl;
+        s << *block._c_val_tbl;
+        s << *block._cc_val_tbl;
+        s << *block._cap_node_tbl;
+      },
+      [&block](dbOStream& s) { s << *block._r_seg_tbl; },
+      [&block](dbOStream& s) {
+        s << *block._cc_seg_tbl;
+        s << *block._extControl;
+      },
+  });
 
   //---------------------------------------------------------- stream out
   // properties
@@ -1018,51 +1039,115 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> block._maxExtModelIndex;
   stream >> block._children;
   stream >> block._currentCcAdjOrder;
-  stream >> *block._bterm_tbl;
-  stream >> *block._iterm_tbl;
-  stream >> *block._net_tbl;
-  stream >> *block._inst_hdr_tbl;
-  stream >> *block._inst_tbl;
-  stream >> *block._module_tbl;
-  stream >> *block._modinst_tbl;
-  stream >> *block._powerdomain_tbl;
-  stream >> *block._logicport_tbl;
-  stream >> *block._powerswitch_tbl;
-  stream >> *block._isolation_tbl;
-  stream >> *block._group_tbl;
-  stream >> *block.ap_tbl_;
-  if (db->isSchema(db_schema_add_global_connect)) {
-    stream >> *block.global_connect_tbl_;
-  }
-  stream >> *block._guide_tbl;
-  if (db->isSchema(db_schema_net_tracks)) {
-    stream >> *block._net_tracks_tbl;
+  if (db->isSchema(db_schema_stream_sections)) {
+    stream.readSections({
+        [&block](dbIStream& s) {
+          s >> *block._bterm_tbl;
+          s >> *block._iterm_tbl;
+        },
+        [&block](dbIStream& s) { s >> *block._net_tbl; },
+        [&block](dbIStream& s) {
+          s >> *block._inst_hdr_tbl;
+          s >> *block._inst_tbl;
+        },
+        [&block](dbIStream& s) {
+          s >> *block._module_tbl;
+          s >> *block._modinst_tbl;
+          s >> *block._powerdomain_tbl;
+          s >> *block._logicport_tbl;
+          s >> *block._powerswitch_tbl;
+          s >> *block._isolation_tbl;
+          s >> *block._group_tbl;
+          s >> *block.ap_tbl_;
+          s >> *block.global_connect_tbl_;
+        },
+        [&block](dbIStream& s) {
+          s >> *block._guide_tbl;
+          s >> *block._net_tracks_tbl;
+        },
+        [&block](dbIStream& s) { s >> *block._box_tbl; },
+        [&block](dbIStream& s) {
+          s >> *block._via_tbl;
+          s >> *block._gcell_grid_tbl;
+          s >> *block._track_grid_tbl;
+          s >> *block._obstruction_tbl;
+          s >> *block._blockage_tbl;
+        },
+        [&block](dbIStream& s) { s >> *block._wire_tbl; },
+        [&block](dbIStream& s) {
+          s >> *block._swire_tbl;
+          s >> *block._sbox_tbl;
+        },
+        [&block](dbIStream& s) {
+          s >> *block._row_tbl;
+          s >> *block._fill_tbl;
+          s >> *block._region_tbl;
+          s >> *block._hier_tbl;
+          s >> *block._bpin_tbl;
+          s >> *block._non_default_rule_tbl;
+          s >> *block._layer_rule_tbl;
+          s >> *block._prop_tbl;
+        },
+        [&block](dbIStream& s) { s >> *block._name_cache; },
+        [&block](dbIStream& s) {
+          s >> *block._r_val_tbl;
+          s >> *block._c_val_tbl;
+          s >> *block._cc_val_tbl;
+          s >> *block._cap_node_tbl;
+        },
+        [&block](dbIStream& s) { s >> *block._r_seg_tbl; },
+        [&block](dbIStream& s) {
+          s >> *block._cc_seg_tbl;
+          s >> *block._extControl;
+        },
+    });
+  } else {
+    stream >> *block._bterm_tbl;
+    stream >> *block._iterm_tbl;
+    stream >> *block._net_tbl;
+    stream >> *block._inst_hdr_tbl;
+    stream >> *block._inst_tbl;
+    stream >> *block._module_tbl;
+    stream >> *block._modinst_tbl;
+    stream >> *block._powerdomain_tbl;
+    stream >> *block._logicport_tbl;
+    stream >> *block._powerswitch_tbl;
+    stream >> *block._isolation_tbl;
+    stream >> *block._group_tbl;
+    stream >> *block.ap_tbl_;
+    if (db->isSchema(db_schema_add_global_connect)) {
+      stream >> *block.global_connect_tbl_;
+    }
+    stream >> *block._guide_tbl;
+    if (db->isSchema(db_schema_net_tracks)) {
+      stream >> *block._net_tracks_tbl;
+    }
+    stream >> *block._box_tbl;
+    stream >> *block._via_tbl;
+    stream >> *block._gcell_grid_tbl;
+    stream >> *block._track_grid_tbl;
+    stream >> *block._obstruction_tbl;
+    stream >> *block._blockage_tbl;
+    stream >> *block._wire_tbl;
+    stream >> *block._swire_tbl;
+    stream >> *block._sbox_tbl;
+    stream >> *block._row_tbl;
+    stream >> *block._fill_tbl;
+    stream >> *block._region_tbl;
+    stream >> *block._hier_tbl;
+    stream >> *block._bpin_tbl;
+    stream >> *block._non_default_rule_tbl;
+    stream >> *block._layer_rule_tbl;
+    stream >> *block._prop_tbl;
+    stream >> *block._name_cache;
+    stream >> *block._r_val_tbl;
+    stream >> *block._c_val_tbl;
+    stream >> *block._cc_val_tbl;
+    stream >> *block._cap_node_tbl;  // DKF
+    stream >> *block._r_seg_tbl;     // DKF
+    stream >> *block._cc_seg_tbl;
+    stream >> *block._extControl;
   }
-  stream >> *block._box_tbl;
-  stream >> *block._via_tbl;
-  stream >> *block._gcell_grid_tbl;
-  stream >> *block._track_grid_tbl;
-  stream >> *block._obstruction_tbl;
-  stream >> *block._blockage_tbl;
-  stream >> *block._wire_tbl;
-  stream >> *block._swire_tbl;
-  stream >> *block._sbox_tbl;
-  stream >> *block._row_tbl;
-  stream >> *block._fill_tbl;
-  stream >> *block._region_tbl;
-  stream >> *block._hier_tbl;
-  stream >> *block._bpin_tbl;
-  stream >> *block._non_default_rule_tbl;
-  stream >> *block._layer_rule_tbl;
-  stream >> *block._prop_tbl;
-  stream >> *block._name_cache;
-  stream >> *block._r_val_tbl;
-  stream >> *block._c_val_tbl;
-  stream >> *block._cc_val_tbl;
-  stream >> *block._cap_node_tbl;  // DKF
-  stream >> *block._r_seg_tbl;     // DKF
-  stream >> *block._cc_seg_tbl;
-  stream >> *block._extControl;
 
   //---------------------------------------------------------- stream in
   // properties
@@ -32,6 +32,11 @@
 
 #include "dbDatabase.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
 #include <map>
 #include <string>
@@ -283,9 +288,11 @@ dbOStream& operator<<(dbOStream& stream, const _dbDatabase& db)
   stream << db._master_id;
   stream << db._chip;
   stream << db._tech;
-  stream << *db._tech_tbl;
-  stream << *db._lib_tbl;
-  stream << *db._chip_tbl;
+  stream.writeSections({
+      [&db](dbOStream& s) { s << *db._tech_tbl; },
+      [&db](dbOStream& s) { s << *db._lib_tbl; },
+      [&db](dbOStream& s) { s << *db._chip_tbl; },
+  });
   stream << *db._prop_tbl;
   stream << *db._name_cache;
   return stream;
@@ -317,9 +324,17 @@ dbIStream& operator>>(dbIStream& stream, _dbDatabase& db)
 
   stream >> db._chip;
   stream >> db._tech;
-  stream >> *db._tech_tbl;
-  stream >> *db._lib_tbl;
-  stream >> *db._chip_tbl;
+  if (db.isSchema(db_schema_stream_sections)) {
+    stream.readSections({
+        [&db](dbIStream& s) { s >> *db._tech_tbl; },
+        [&db](dbIStream& s) { s >> *db._lib_tbl; },
+        [&db](dbIStream& s) { s >> *db._chip_tbl; },
+    });
+  } else {
+    stream >> *db._tech_tbl;
+    stream >> *db._lib_tbl;
+    stream >> *db._chip_tbl;
+  }
   stream >> *db._prop_tbl;
   stream >> *db._name_cache;
 
@@ -418,6 +433,42 @@ void dbDatabase::read(std::ifstream& file)
   stream >> *db;
 }
 
+void dbDatabase::read(const char* file_name)
+{
+  _dbDatabase* db = (_dbDatabase*) this;
+
+  const int fd = open(file_name, O_RDONLY);
+  struct stat st;
+  void* map = MAP_FAILED;
+  if (fd >= 0) {
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+  }
+
+  // Anything that can't be mapped is read through a stream.
+  if (map == MAP_FAILED) {
+    std::ifstream file;
+    file.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                    | std::ios::eofbit);
+    file.open(file_name, std::ios::binary);
+    read(file);
+    return;
+  }
+
+  // The sections are parsed concurrently, let the kernel read ahead.
+  madvise(map, st.st_size, MADV_WILLNEED);
+  try {
+    dbIStream stream(db, static_cast<const char*>(map), st.st_size);
+    stream >> *db;
+  } catch (...) {
+    munmap(map, st.st_size);
+    throw;
+  }
+  munmap(map, st.st_size);
+}
+
 void dbDatabase::readTech(std::ifstream& file)
 {
   _dbDatabase* db = (_dbDatabase*) this;
@@ -512,10 +563,11 @@ void dbDatabase::readChip(std::ifstream& file)
   stream >> *chip;
 }
 
-void dbDatabase::write(FILE* file)
+void dbDatabase::write(FILE* file, bool compress)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
+  stream.setCompress(compress);
   stream << *db;
   fflush(file);
 }
@@ -69,7 +69,14 @@ namespace odb {
 //
 const uint db_schema_major = 0;  // Not used...
 const uint db_schema_initial = 57;
-const uint db_schema_minor = 65;  // Current revision number
+const uint db_schema_minor = 67;  // Current revision number
+
+// Revision where the stored size of each (compressed) section was added
+const uint db_schema_compressed_sections = 67;
+
+// Revision where the tech, libs, chip and block tables are streamed as
+// independent sections
+const uint db_schema_stream_sections = 66;
 
 // Revision where _dbGCellGrid switch to using dbMatrix
 const uint db_schema_gcell_grid_matrix = 65;
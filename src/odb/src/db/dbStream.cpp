@@ -32,9 +32,16 @@
 
 #include "dbStream.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "db.h"
+#include "dbDatabase.h"
+#include "zlib.h"
 
 namespace odb {
 
@@ -86,10 +93,58 @@ dbIStream& operator>>(dbIStream& stream, Oct& o)
   return stream;
 }
 
+// The state shared by the sections of one writeSections call.  The turn is
+// the first section that is not completely written to the parent yet.
+struct dbOStream::SectionWriter
+{
+  struct Part
+  {
+    std::vector<char> buffer;
+    uint64_t size = 0;
+    uint64_t stored_size = 0;
+    long start = -1;  // position in the parent once it writes there directly
+    bool holds_sections = false;
+    bool done = false;
+    std::exception_ptr error;
+  };
+
+  dbOStream* parent;
+  bool in_order;  // false if the index can't be filled in afterwards
+  std::vector<Part> parts;
+  std::mutex mutex;
+  std::condition_variable changed;
+  size_t turn = 0;
+  size_t running = 0;
+  std::exception_ptr error;
+
+  // Writes the finished sections that are next in line, called with the
+  // mutex held.
+  void advance()
+  {
+    while (turn < parts.size() && parts[turn].done) {
+      Part& part = parts[turn++];
+      try {
+        if (!error && !part.buffer.empty()) {
+          parent->write(part.buffer.data(), part.buffer.size());
+        }
+      } catch (...) {
+        error = std::current_exception();
+      }
+      std::vector<char>().swap(part.buffer);
+    }
+    changed.notify_all();
+  }
+};
+
 dbOStream::dbOStream(_dbDatabase* db, FILE* f)
 {
   _db = db;
   _f = f;
+  _section = nullptr;
+  _compress = false;
+  _writer = nullptr;
+  _index = 0;
+  _flush_size = SIZE_MAX;
   _lef_dist_factor = 0.001;
   _lef_area_factor = 0.000001;
 
@@ -101,14 +156,215 @@ dbOStream::dbOStream(_dbDatabase* db, FILE* f)
   }
 }
 
-dbIStream::dbIStream(_dbDatabase* db, std::ifstream& f) : _f(f)
+dbOStream::dbOStream(const dbOStream& parent,
+                     std::vector<char>& section,
+                     SectionWriter* writer,
+                     size_t index)
+    : _db(parent._db),
+      _f(nullptr),
+      _lef_area_factor(parent._lef_area_factor),
+      _lef_dist_factor(parent._lef_dist_factor),
+      _section(&section),
+      _compress(parent._compress),
+      _writer(writer),
+      _index(index),
+      // A section that is compressed stays in memory, the others check for
+      // their turn on the first write.
+      _flush_size(_compress || !writer->in_order ? SIZE_MAX : 0)
+{
+}
+
+// Writes the section to the parent directly if it is its turn, otherwise
+// checks again after another chunk is held in memory.
+void dbOStream::flushSection()
+{
+  std::lock_guard<std::mutex> lock(_writer->mutex);
+  if (_writer->turn == _index) {
+    startWriting();
+  } else {
+    _flush_size = _section->size() + (1 << 20);
+  }
+}
+
+// Called with the mutex held on the turn of this section.
+void dbOStream::startWriting()
+{
+  dbOStream* parent = _writer->parent;
+  _writer->parts[_index].start = parent->position();
+  if (!_section->empty()) {
+    parent->write(_section->data(), _section->size());
+  }
+  std::vector<char>().swap(*_section);
+  _f = parent->_f;
+  _section = parent->_section;
+  _flush_size = SIZE_MAX;
+}
+
+// Returns an empty buffer if the data doesn't shrink.
+static std::vector<char> compressSection(const std::vector<char>& data)
+{
+  uLongf size = compressBound(data.size());
+  std::vector<char> compressed(size);
+  const int status = compress2(reinterpret_cast<Bytef*>(compressed.data()),
+                               &size,
+                               reinterpret_cast<const Bytef*>(data.data()),
+                               data.size(),
+                               Z_BEST_SPEED);
+  if (status != Z_OK || size >= data.size()) {
+    return {};
+  }
+  compressed.resize(size);
+  return compressed;
+}
+
+void dbOStream::writeSections(const std::vector<Section>& sections)
+{
+  // A section holding sections waits for its turn and writes them to the
+  // parent directly.  It is stored as is, its sections are compressed.
+  if (_writer) {
+    SectionWriter::Part& part = _writer->parts[_index];
+    part.holds_sections = true;
+    if (_writer->in_order && part.start < 0) {
+      std::unique_lock<std::mutex> lock(_writer->mutex);
+      _writer->changed.wait(lock, [this] { return _writer->turn == _index; });
+      startWriting();
+    }
+  }
+
+  const size_t count = sections.size();
+  SectionWriter writer;
+  writer.parent = this;
+  writer.parts.resize(count);
+
+  // A section is compressed when its stored size differs from its size.
+  const auto write_index = [&] {
+    std::vector<char> index;
+    const auto add = [&index](const auto& value) {
+      const char* p = reinterpret_cast<const char*>(&value);
+      index.insert(index.end(), p, p + sizeof(value));
+    };
+    add((uint) count);
+    for (const auto& part : writer.parts) {
+      add(part.size);
+      add(part.stored_size);
+    }
+    return index;
+  };
+
+  // Without a known position the sections are written after the index once
+  // they are all done.
+  const long index_pos = position();
+  writer.in_order = index_pos >= 0;
+  if (writer.in_order) {
+    const std::vector<char> index = write_index();
+    write(index.data(), index.size());
+  }
+
+  const size_t max_running
+      = std::max(std::thread::hardware_concurrency(), 1u);
+  std::vector<std::thread> threads;
+  threads.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    {
+      std::unique_lock<std::mutex> lock(writer.mutex);
+      writer.changed.wait(lock,
+                          [&] { return writer.running < max_running; });
+      writer.running++;
+    }
+    threads.emplace_back([&, i] {
+      SectionWriter::Part& part = writer.parts[i];
+      bool written = false;
+      try {
+        dbOStream stream(*this, part.buffer, &writer, i);
+        sections[i](stream);
+        written = part.start >= 0;
+        if (!written) {
+          part.size = part.buffer.size();
+          if (stream._compress && !part.holds_sections) {
+            std::vector<char> compressed = compressSection(part.buffer);
+            if (!compressed.empty()) {
+              part.buffer = std::move(compressed);
+            }
+          }
+          part.stored_size = part.buffer.size();
+        }
+      } catch (...) {
+        part.error = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(writer.mutex);
+      if (written) {
+        part.size = part.stored_size = position() - part.start;
+      }
+      part.done = true;
+      writer.running--;
+      if (writer.in_order) {
+        writer.advance();
+      } else {
+        writer.changed.notify_all();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& part : writer.parts) {
+    if (part.error) {
+      std::rethrow_exception(part.error);
+    }
+  }
+  if (writer.error) {
+    std::rethrow_exception(writer.error);
+  }
+
+  const std::vector<char> index = write_index();
+  if (!writer.in_order) {
+    write(index.data(), index.size());
+    for (auto& part : writer.parts) {
+      if (!part.buffer.empty()) {
+        write(part.buffer.data(), part.buffer.size());
+      }
+    }
+  } else if (_f) {
+    if (fseek(_f, index_pos, SEEK_SET) != 0) {
+      write_error();
+    }
+    write(index.data(), index.size());
+    if (fseek(_f, 0, SEEK_END) != 0) {
+      write_error();
+    }
+  } else {
+    std::copy(index.begin(), index.end(), _section->begin() + index_pos);
+  }
+}
+
+dbIStream::dbIStream(_dbDatabase* db, std::ifstream& f)
+    : _f(&f), _data(nullptr), _pos(0), _size(0), _remaining(0)
 {
   _db = db;
+  initFactors();
 
+  // Without a known size the stream is read field by field.
+  const std::streampos start = _f->tellg();
+  if (start != std::streampos(-1)) {
+    _f->seekg(0, std::ios::end);
+    _remaining = _f->tellg() - start;
+    _f->seekg(start);
+  }
+}
+
+dbIStream::dbIStream(_dbDatabase* db, const char* data, size_t size)
+    : _f(nullptr), _db(db), _data(data), _pos(0), _size(size), _remaining(0)
+{
+  initFactors();
+}
+
+void dbIStream::initFactors()
+{
   _lef_dist_factor = 0.001;
   _lef_area_factor = 0.000001;
 
-  dbTech* tech = ((dbDatabase*) db)->getTech();
+  dbTech* tech = ((dbDatabase*) _db)->getTech();
 
   if (tech && tech->getLefUnits() == 2000) {
     _lef_dist_factor = 0.0005;
@@ -116,6 +372,140 @@ dbIStream::dbIStream(_dbDatabase* db, std::ifstream& f) : _f(f)
   }
 }
 
+dbIStream::dbIStream(const dbIStream& parent, const char* data, size_t size)
+    : _f(nullptr),
+      _db(parent._db),
+      _lef_area_factor(parent._lef_area_factor),
+      _lef_dist_factor(parent._lef_dist_factor),
+      _data(data),
+      _pos(0),
+      _size(size),
+      _remaining(0)
+{
+}
+
+dbIStream::~dbIStream()
+{
+  if (_f && _pos < _size) {
+    try {
+      _f->seekg(-(std::streamoff) (_size - _pos), std::ios::cur);
+    } catch (std::ios_base::failure&) {
+    }
+  }
+}
+
+void dbIStream::readSections(const std::vector<Section>& sections)
+{
+  const size_t count = sections.size();
+
+  uint file_count;
+  *this >> file_count;
+  if (file_count != count) {
+    throw ZException("database has %u sections where %zu are expected",
+                     file_count,
+                     count);
+  }
+
+  std::vector<uint64_t> sizes(count);
+  std::vector<uint64_t> stored_sizes(count);
+  const bool has_stored_sizes = _db->isSchema(db_schema_compressed_sections);
+  for (size_t i = 0; i < count; ++i) {
+    *this >> sizes[i];
+    stored_sizes[i] = sizes[i];
+    if (has_stored_sizes) {
+      *this >> stored_sizes[i];
+    }
+  }
+
+  // The sections of a file are read into memory, the sections held in
+  // memory already are parsed where they are.
+  std::vector<std::vector<char>> buffers(count);
+  std::vector<const char*> data(count);
+  for (size_t i = 0; i < count; ++i) {
+    if (_f) {
+      buffers[i].resize(stored_sizes[i]);
+      read(buffers[i].data(), stored_sizes[i]);
+      data[i] = buffers[i].data();
+    } else {
+      if (_size - _pos < stored_sizes[i]) {
+        throw ZException("read past the end of the database data");
+      }
+      data[i] = _data + _pos;
+      _pos += stored_sizes[i];
+    }
+  }
+
+  std::vector<std::exception_ptr> errors(count);
+  std::vector<std::thread> threads;
+  threads.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    threads.emplace_back([&, i] {
+      try {
+        std::vector<char> buffer = std::move(buffers[i]);
+        if (stored_sizes[i] != sizes[i]) {
+          std::vector<char> inflated(sizes[i]);
+          uLongf size = sizes[i];
+          const int status
+              = uncompress(reinterpret_cast<Bytef*>(inflated.data()),
+                           &size,
+                           reinterpret_cast<const Bytef*>(data[i]),
+                           stored_sizes[i]);
+          if (status != Z_OK || size != sizes[i]) {
+            throw ZException("database section %zu is corrupt", i);
+          }
+          buffer = std::move(inflated);
+          data[i] = buffer.data();
+        }
+        dbIStream stream(*this, data[i], sizes[i]);
+        sections[i](stream);
+        if (stream._pos != stream._size) {
+          throw ZException("database section %zu was not fully read", i);
+        }
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+void dbIStream::readSlow(char* c, size_t n)
+{
+  if (_f == nullptr) {
+    throw ZException("read past the end of the database data");
+  }
+
+  const size_t buffered = _size - _pos;
+  memcpy(c, _data + _pos, buffered);
+  c += buffered;
+  n -= buffered;
+  _pos = _size = 0;
+
+  constexpr size_t chunk_size = 1 << 20;
+  if (n >= chunk_size || (std::streamoff) n > _remaining) {
+    // A short read fails here just like an unbuffered one.
+    _f->read(c, n);
+    _remaining = std::max(_remaining - (std::streamoff) n, std::streamoff(0));
+    return;
+  }
+
+  _size = std::min((std::streamoff) chunk_size, _remaining);
+  _buffer.resize(_size);
+  _data = _buffer.data();
+  _f->read(_buffer.data(), _size);
+  _remaining -= _size;
+  memcpy(c, _buffer.data(), n);
+  _pos = n;
+}
+
 std::ostream& operator<<(std::ostream& os, const Rect& box)
 {
   os << "( " << box.xMin() << " " << box.yMin() << " ) ( " << box.xMax() << " "
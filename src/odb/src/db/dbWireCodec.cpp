@@ -600,6 +600,10 @@ void dbWireEncoder::end()
 
   uint n = _opcodes.size();
 
+  for (auto callback : ((_dbBlock*) _block)->_callbacks) {
+    callback->inDbWirePreModify((dbWire*) _wire);
+  }
+
   // Free the old memory
   _wire->_data.~dbVector<int>();
   new (&_wire->_data) dbVector<int>();
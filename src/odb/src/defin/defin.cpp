@@ -92,6 +92,11 @@ void defin::setAssemblyMode()
   _reader->setAssemblyMode();
 }
 
+void defin::setThreads(int threads)
+{
+  _reader->setThreads(threads);
+}
+
 void defin::useBlockName(const char* name)
 {
   _reader->useBlockName(name);
@@ -36,6 +36,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 #include "db.h"
 #include "dbShape.h"
 #include "dbWireCodec.h"
@@ -69,6 +73,7 @@ definNet::definNet()
   _replace_wires = false;
   _names_are_ids = false;
   _assembly_mode = false;
+  _threads = 1;
 }
 
 definNet::~definNet()
@@ -95,6 +100,9 @@ void definNet::init()
   _non_default_rule = NULL;
   _rule_for_path = NULL;
   _rotated_vias.clear();
+  _wire_ops.clear();
+  _wire_jobs.clear();
+  _pending_wires.clear();
 }
 
 void definNet::begin(const char* name)
@@ -126,7 +134,7 @@ void definNet::begin(const char* name)
         dbWire* wire = _cur_net->getWire();
 
         if (wire)
-          dbWire::destroy(wire);
+          destroyWire(wire);
       }
     }
 
@@ -339,7 +347,10 @@ void definNet::wire(dbWireType type)
       if (_wire == NULL)
         _wire = dbWire::create(_cur_net);
     }
-    _wire_encoder.begin(_wire);
+    if (_threads > 1)
+      _wire_ops.clear();
+    else
+      _wire_encoder.begin(_wire);
   }
 
   _wire_type = type;
@@ -363,7 +374,7 @@ void definNet::pathBegin(const char* layer_name)
     _logger->warn(
         utl::ODB, 104, "error: undefined layer ({}) referenced", layer_name);
     ++_errors;
-    dbWire::destroy(_wire);
+    destroyWire(_wire);
     _wire = NULL;
     return;
   }
@@ -384,10 +395,11 @@ void definNet::pathBegin(const char* layer_name)
     }
   }
 
-  if (_taper_rule)
-    _wire_encoder.newPath(_cur_layer, _wire_type, _taper_rule);
-  else
-    _wire_encoder.newPath(_cur_layer, _wire_type);
+  addWireOp({WireOp::PATH,
+             _cur_layer,
+             _taper_rule,
+             _wire_type.getValue(),
+             {0, 0, 0, 0}});
 }
 
 void definNet::pathTaper(const char* layer)
@@ -421,7 +433,11 @@ void definNet::pathPoint(int x, int y)
   _prev_x = dbdist(x);
   _prev_y = dbdist(y);
 
-  _wire_encoder.addPoint(_prev_x, _prev_y);
+  addWireOp({WireOp::POINT,
+             nullptr,
+             nullptr,
+             dbWireType::NONE,
+             {_prev_x, _prev_y, 0, 0}});
 }
 
 void definNet::pathPoint(int x, int y, int ext)
@@ -432,7 +448,11 @@ void definNet::pathPoint(int x, int y, int ext)
   _prev_x = dbdist(x);
   _prev_y = dbdist(y);
 
-  _wire_encoder.addPoint(_prev_x, _prev_y, dbdist(ext));
+  addWireOp({WireOp::POINT_EXT,
+             nullptr,
+             nullptr,
+             dbWireType::NONE,
+             {_prev_x, _prev_y, dbdist(ext), 0}});
 }
 
 void definNet::getUniqueViaName(std::string& viaName)
@@ -537,7 +557,7 @@ void definNet::pathVia(const char* via_name, dbOrientType orient)
   if (via == NULL)
     return;
 
-  _wire_encoder.addVia(via);
+  addWireOp({WireOp::VIA, via, nullptr, dbWireType::NONE, {0, 0, 0, 0}});
   dbTechLayer* top = via->getTopLayer();
   dbTechLayer* bot = via->getBottomLayer();
 
@@ -564,7 +584,8 @@ void definNet::pathVia(const char* via_name)
   dbTechVia* tech_via = _tech->findVia(via_name);
 
   if (tech_via != NULL) {
-    _wire_encoder.addTechVia(tech_via);
+    addWireOp(
+        {WireOp::TECH_VIA, tech_via, nullptr, dbWireType::NONE, {0, 0, 0, 0}});
     top = tech_via->getTopLayer();
     bot = tech_via->getBottomLayer();
   } else {
@@ -577,7 +598,7 @@ void definNet::pathVia(const char* via_name)
       return;
     }
 
-    _wire_encoder.addVia(via);
+    addWireOp({WireOp::VIA, via, nullptr, dbWireType::NONE, {0, 0, 0, 0}});
     top = via->getTopLayer();
     bot = via->getBottomLayer();
   }
@@ -603,13 +624,18 @@ void definNet::pathVia(const char* via_name)
 
 void definNet::pathRect(int deltaX1, int deltaY1, int deltaX2, int deltaY2)
 {
-  _wire_encoder.addRect(
-      dbdist(deltaX1), dbdist(deltaY1), dbdist(deltaX2), dbdist(deltaY2));
+  const int x1 = dbdist(deltaX1);
+  const int y1 = dbdist(deltaY1);
+  const int x2 = dbdist(deltaX2);
+  const int y2 = dbdist(deltaY2);
+  addWireOp(
+      {WireOp::RECT, nullptr, nullptr, dbWireType::NONE, {x1, y1, x2, y2}});
 }
 
 void definNet::pathColor(int color)
 {
-  _wire_encoder.setColor(static_cast<uint8_t>(color));
+  addWireOp(
+      {WireOp::COLOR, nullptr, nullptr, dbWireType::NONE, {color, 0, 0, 0}});
 }
 
 void definNet::pathEnd()
@@ -678,8 +704,17 @@ void definNet::end()
   if (_wire) {
     if (_assembly_mode && !_found_new_routing) {
       _wire_encoder.clear();
+      _wire_ops.clear();
     } else {
-      _wire_encoder.end();
+      if (_threads > 1) {
+        _wire_jobs.push_back({_wire, std::move(_wire_ops), nullptr});
+        _wire_ops.clear();
+        _pending_wires.insert(_wire);
+        if (_wire_jobs.size() >= 10000)
+          flushWires();
+      } else {
+        _wire_encoder.end();
+      }
 
       if (_replace_wires)
         _cur_net->setWireAltered(true);
@@ -688,4 +723,101 @@ void definNet::end()
   _cur_net = NULL;
 }
 
+void definNet::addWireOp(const WireOp& op)
+{
+  if (_threads > 1) {
+    if (_wire)
+      _wire_ops.push_back(op);
+  } else {
+    applyWireOp(_wire_encoder, op);
+  }
+}
+
+void definNet::applyWireOp(dbWireEncoder& encoder, const WireOp& op)
+{
+  const int* v = op.values;
+  switch (op.type) {
+    case WireOp::PATH:
+      if (op.rule)
+        encoder.newPath(
+            (dbTechLayer*) op.object, dbWireType(op.wire_type), op.rule);
+      else
+        encoder.newPath((dbTechLayer*) op.object, dbWireType(op.wire_type));
+      break;
+    case WireOp::POINT:
+      encoder.addPoint(v[0], v[1]);
+      break;
+    case WireOp::POINT_EXT:
+      encoder.addPoint(v[0], v[1], v[2]);
+      break;
+    case WireOp::VIA:
+      encoder.addVia((dbVia*) op.object);
+      break;
+    case WireOp::TECH_VIA:
+      encoder.addTechVia((dbTechVia*) op.object);
+      break;
+    case WireOp::RECT:
+      encoder.addRect(v[0], v[1], v[2], v[3]);
+      break;
+    case WireOp::COLOR:
+      encoder.setColor(static_cast<uint8_t>(v[0]));
+      break;
+  }
+}
+
+void definNet::destroyWire(dbWire* wire)
+{
+  // A pending wire must be stored before it can be destroyed.
+  if (_pending_wires.find(wire) != _pending_wires.end())
+    flushWires();
+
+  if (wire == _wire)
+    _wire_ops.clear();
+
+  dbWire::destroy(wire);
+}
+
+void definNet::flushWires()
+{
+  if (_wire_jobs.empty())
+    return;
+
+  const int threads = std::min((size_t) _threads, _wire_jobs.size());
+  std::vector<std::exception_ptr> errors(threads);
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([this, t, threads, &errors] {
+      try {
+        for (size_t i = t; i < _wire_jobs.size(); i += threads) {
+          WireJob& job = _wire_jobs[i];
+          job.encoder = std::make_unique<dbWireEncoder>();
+          job.encoder->begin(job.wire);
+          for (const WireOp& op : job.ops)
+            applyWireOp(*job.encoder, op);
+          job.ops = std::vector<WireOp>();
+        }
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    });
+  }
+  for (std::thread& worker : workers)
+    worker.join();
+
+  for (std::exception_ptr& error : errors) {
+    if (error) {
+      _wire_jobs.clear();
+      _pending_wires.clear();
+      std::rethrow_exception(error);
+    }
+  }
+
+  // Storing a wire updates the block so it is done here in net order.
+  for (WireJob& job : _wire_jobs)
+    job.encoder->end();
+  _wire_jobs.clear();
+  _pending_wires.clear();
+}
+
 }  // namespace odb
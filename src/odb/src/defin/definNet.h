@@ -33,7 +33,10 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "dbWireCodec.h"
 #include "definBase.h"
@@ -41,6 +44,7 @@
 
 namespace odb {
 
+class dbObject;
 class dbWire;
 class dbSWire;
 class dbNet;
@@ -51,6 +55,34 @@ class dbTechNonDefaultRule;
 
 class definNet : public definBase
 {
+  // A wire encoder call recorded while parsing
+  struct WireOp
+  {
+    enum Type
+    {
+      PATH,
+      POINT,
+      POINT_EXT,
+      VIA,
+      TECH_VIA,
+      RECT,
+      COLOR
+    };
+    Type type;
+    dbObject* object;  // layer, via or tech via
+    dbTechLayerRule* rule;
+    dbWireType::Value wire_type;
+    int values[4];
+  };
+
+  // The recorded wire of a net waiting to be encoded
+  struct WireJob
+  {
+    dbWire* wire;
+    std::vector<WireOp> ops;
+    std::unique_ptr<dbWireEncoder> encoder;
+  };
+
   bool _skip_signal_connections;
   bool _skip_wires;
   bool _replace_wires;
@@ -71,7 +103,16 @@ class definNet : public definBase
   dbTechNonDefaultRule* _non_default_rule;
   dbTechNonDefaultRule* _rule_for_path;
   std::map<std::string, dbVia*> _rotated_vias;
+  // With more than one thread the wires are recorded and encoded in batches
+  // by worker threads; the block is only updated from the parsing thread.
+  int _threads;
+  std::vector<WireOp> _wire_ops;
+  std::vector<WireJob> _wire_jobs;
+  std::unordered_set<dbWire*> _pending_wires;
 
+  void addWireOp(const WireOp& op);
+  static void applyWireOp(dbWireEncoder& encoder, const WireOp& op);
+  void destroyWire(dbWire* wire);
   void getUniqueViaName(std::string& viaName);
   dbVia* getRotatedVia(const char* via_name, dbOrientType orient);
   dbTechNonDefaultRule* findNonDefaultRule(const char* name);
@@ -122,6 +163,9 @@ class definNet : public definBase
   void replaceWires() { _replace_wires = true; }
   void setAssemblyMode() { _assembly_mode = true; }
   void namesAreDBIDs() { _names_are_ids = true; }
+  void setThreads(int threads) { _threads = threads; }
+  // Encode and store the wires of the nets read so far.
+  void flushWires();
 };
 
 }  // namespace odb
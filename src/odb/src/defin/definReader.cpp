@@ -202,6 +202,11 @@ void definReader::setAssemblyMode()
   _netR->setAssemblyMode();
 }
 
+void definReader::setThreads(int threads)
+{
+  _netR->setThreads(threads);
+}
+
 void definReader::useBlockName(const char* name)
 {
   if (_block_name)
@@ -1449,6 +1454,8 @@ int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
   definReader* reader = (definReader*) data;
   CHECKBLOCK
   definSNet* snetR = reader->_snetR;
+  // Special nets may replace the wires of nets that are still pending.
+  reader->_netR->flushWires();
   if (reader->_mode == defin::FLOORPLAN
       && reader->_block->findNet(net->name()) == nullptr) {
     reader->_logger->warn(
@@ -1840,6 +1847,7 @@ bool definReader::createBlock(const char* file)
     res = defrReadGZip(f, file, (defiUserData) this);
     defGZipClose(f);
   }
+  _netR->flushWires();
 
   if (res != 0 || errors() != 0) {
     if (!_continue_on_errors) {
@@ -1877,6 +1885,7 @@ bool definReader::replaceWires(const char* file)
   defrSetAddPathToNet();
 
   int res = defrRead(f, file, (defiUserData) this, /* case sensitive */ 1);
+  _netR->flushWires();
   if (res != 0) {
     if (!_continue_on_errors) {
       _logger->error(utl::ODB, 422, "DEF parser returns an error!");
@@ -256,6 +256,7 @@ class definReader : public definBase
   void useBlockName(const char* name);
   void namesAreDBIDs();
   void setAssemblyMode();
+  void setThreads(int threads);
 
   dbChip* createChip(std::vector<dbLib*>& search_libs, const char* def_file);
   dbBlock* createBlock(dbBlock* parent,
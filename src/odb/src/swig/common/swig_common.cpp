@@ -151,12 +151,7 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
     db = odb::dbDatabase::create();
   }
 
-  std::ifstream file;
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                  | std::ios::eofbit);
-  file.open(db_path, std::ios::binary);
-
-  db->read(file);
+  db->read(db_path);
 
   return db;
 }
@@ -117,6 +117,7 @@ void Ath__parser::init()
   for (int ii = 0; ii < _maxWordCnt; ii++) {
     _wordArray[ii] = ATH__allocCharWord(512, _logger);
   }
+  _words = _wordArray;
 
   _wordSeparators = ATH__allocCharWord(24, _logger);
 
@@ -130,6 +131,12 @@ void Ath__parser::init()
   _inFP = nullptr;
   _inputFile = ATH__allocCharWord(512, _logger);
 
+  _inputWords = nullptr;
+  _inputLineStarts = nullptr;
+  _inputLineNums = nullptr;
+  _inputLineCnt = 0;
+  _inputLine = 0;
+
   _progressLineChunk = 1000000;
 }
 
@@ -145,7 +152,7 @@ void Ath__parser::resetLineNum(int v)
 
 bool Ath__parser::isDigit(int ii, int jj)
 {
-  const char C = _wordArray[ii][jj];
+  const char C = _words[ii][jj];
 
   return (C >= '0') && (C <= '9');
 }
@@ -196,13 +203,30 @@ void Ath__parser::setInputFP(FILE* fp)
   _inFP = fp;
 }
 
+void Ath__parser::setInputWords(char** words,
+                                const int* lineStarts,
+                                const int* lineNums,
+                                int lineCnt)
+{
+  _inputWords = words;
+  _inputLineStarts = lineStarts;
+  _inputLineNums = lineNums;
+  _inputLineCnt = lineCnt;
+  _inputLine = 0;
+}
+
+void Ath__parser::setNextInput(std::function<bool()> nextInput)
+{
+  _nextInput = std::move(nextInput);
+}
+
 void Ath__parser::printWords(FILE* fp)
 {
   if (fp == nullptr) {
     return;
   }
   for (int ii = 0; ii < _currentWordCnt; ii++) {
-    fprintf(fp, "%s ", _wordArray[ii]);
+    fprintf(fp, "%s ", _words[ii]);
   }
   fprintf(fp, "\n");
 }
@@ -222,7 +246,7 @@ char* Ath__parser::get(int ii)
   if ((ii < 0) || (ii >= _currentWordCnt)) {
     return nullptr;
   }
-  return _wordArray[ii];
+  return _words[ii];
 }
 
 int Ath__parser::getInt(int ii)
@@ -296,6 +320,7 @@ int Ath__parser::mkWords(const char* word, const char* sep)
   }
 
   strcpy(_line, word);
+  _words = _wordArray;
   _currentWordCnt = mkWords(0);
 
   if (sep != nullptr) {
@@ -390,6 +415,23 @@ void Ath__parser::reportProgress()
 
 int Ath__parser::readLineAndBreak(int prevWordCnt)
 {
+  if (_inputWords != nullptr) {
+    while (_inputLine == _inputLineCnt) {
+      if (!_nextInput || !_nextInput()) {
+        _currentWordCnt = prevWordCnt;
+        return prevWordCnt;
+      }
+    }
+    const int start = _inputLineStarts[_inputLine];
+    _lineNum = _inputLineNums[_inputLine];
+    reportProgress();
+    _words = _inputWords + start;
+    _currentWordCnt = _inputLineStarts[_inputLine + 1] - start;
+    _inputLine++;
+    return _currentWordCnt;
+  }
+
+  _words = _wordArray;
   if (fgets(_line, _lineSize, _inFP) == nullptr) {
     _currentWordCnt = prevWordCnt;
     return prevWordCnt;
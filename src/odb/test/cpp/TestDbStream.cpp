@@ -0,0 +1,322 @@
+#define BOOST_TEST_MODULE TestDbStream
+#include <boost/test/included/unit_test.hpp>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "db.h"
+#include "dbStream.h"
+#include "helper.cpp"
+
+using namespace odb;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_sequential_streams)
+{
+  dbDatabase* db = createSimpleDB();
+  _dbDatabase* impl = reinterpret_cast<_dbDatabase*>(db);
+  const std::string path
+      = (std::filesystem::temp_directory_path() / "TestDbStream").string();
+
+  // more than one read buffer worth of fields and a string larger than it
+  const int count = 1 << 19;
+  const std::string large(3 << 20, 'x');
+  FILE* write = fopen(path.c_str(), "w");
+  {
+    dbOStream stream(impl, write);
+    for (int i = 0; i < count; i++) {
+      stream << i;
+      stream << (double) i / 2;
+    }
+    stream << large;
+    stream << count;
+  }
+  fclose(write);
+
+  std::ifstream read;
+  read.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  read.open(path.c_str(), std::ios::binary);
+  bool same = true;
+  {
+    dbIStream stream(impl, read);
+    for (int i = 0; i < count / 2; i++) {
+      int value;
+      double half;
+      stream >> value >> half;
+      same &= (value == i && half == (double) i / 2);
+    }
+  }
+  // a new stream continues where the previous one stopped
+  {
+    dbIStream stream(impl, read);
+    for (int i = count / 2; i < count; i++) {
+      int value;
+      double half;
+      stream >> value >> half;
+      same &= (value == i && half == (double) i / 2);
+    }
+    std::string str;
+    stream >> str;
+    same &= (str == large);
+  }
+  BOOST_TEST(same);
+  {
+    dbIStream stream(impl, read);
+    int value;
+    stream >> value;
+    BOOST_TEST(value == count);
+  }
+  dbIStream stream(impl, read);
+  int value;
+  BOOST_CHECK_THROW(stream >> value, std::ios_base::failure);
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_CASE(test_sections)
+{
+  dbDatabase* db = createSimpleDB();
+  _dbDatabase* impl = reinterpret_cast<_dbDatabase*>(db);
+  const std::string path
+      = (std::filesystem::temp_directory_path() / "TestDbStreamSections")
+            .string();
+
+  const int sections = 4;
+  const int count = 1 << 16;
+  FILE* write = fopen(path.c_str(), "w");
+  {
+    dbOStream stream(impl, write);
+    stream << sections;
+    std::vector<dbOStream::Section> writers;
+    for (int s = 0; s < sections; s++) {
+      writers.emplace_back([=](dbOStream& section) {
+        for (int i = 0; i < count * (s + 1); i++) {
+          section << i + s;
+        }
+      });
+    }
+    stream.writeSections(writers);
+    stream << count;
+  }
+  fclose(write);
+
+  std::ifstream read;
+  read.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  read.open(path.c_str(), std::ios::binary);
+  {
+    dbIStream stream(impl, read);
+    int value;
+    stream >> value;
+    BOOST_TEST(value == sections);
+    std::vector<char> same(sections, true);
+    std::vector<dbIStream::Section> readers;
+    for (int s = 0; s < sections; s++) {
+      readers.emplace_back([=, &same](dbIStream& section) {
+        bool ok = true;
+        for (int i = 0; i < count * (s + 1); i++) {
+          int value;
+          section >> value;
+          ok &= (value == i + s);
+        }
+        same[s] = ok;
+      });
+    }
+    stream.readSections(readers);
+    for (int s = 0; s < sections; s++) {
+      BOOST_TEST(same[s]);
+    }
+    stream >> value;
+    BOOST_TEST(value == count);
+  }
+
+  // a section that is not read to its end is an error
+  read.seekg(sizeof(int));
+  dbIStream stream(impl, read);
+  std::vector<dbIStream::Section> readers(
+      sections, [](dbIStream& section) {
+        int value;
+        section >> value;
+      });
+  BOOST_CHECK_THROW(stream.readSections(readers), std::runtime_error);
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_CASE(test_sections_to_pipe)
+{
+  dbDatabase* db = createSimpleDB();
+  _dbDatabase* impl = reinterpret_cast<_dbDatabase*>(db);
+  const std::string path
+      = (std::filesystem::temp_directory_path() / "TestDbStreamPipe")
+            .string();
+
+  // without a position to fill in the index the sections are held in memory
+  const int count = 1 << 16;
+  const auto writer = [=](dbOStream& section) {
+    for (int i = 0; i < count; i++) {
+      section << i;
+    }
+  };
+  int fds[2];
+  BOOST_REQUIRE(pipe(fds) == 0);
+  std::thread copy([&] {
+    std::ofstream out(path, std::ios::binary);
+    char buffer[4096];
+    ssize_t n;
+    while ((n = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+      out.write(buffer, n);
+    }
+    close(fds[0]);
+  });
+  FILE* write = fdopen(fds[1], "w");
+  {
+    dbOStream stream(impl, write);
+    stream.writeSections({writer, [&](dbOStream& section) {
+                            section.writeSections({writer, writer});
+                          }});
+    stream << count;
+  }
+  fclose(write);
+  copy.join();
+
+  std::ifstream read;
+  read.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  read.open(path.c_str(), std::ios::binary);
+  std::vector<char> same(3, false);
+  const auto reader = [=, &same](int idx) {
+    return [=, &same](dbIStream& section) {
+      bool ok = true;
+      for (int i = 0; i < count; i++) {
+        int value;
+        section >> value;
+        ok &= (value == i);
+      }
+      same[idx] = ok;
+    };
+  };
+  dbIStream stream(impl, read);
+  stream.readSections({reader(0), [&](dbIStream& section) {
+                         section.readSections({reader(1), reader(2)});
+                       }});
+  for (char ok : same) {
+    BOOST_TEST(ok);
+  }
+  int value;
+  stream >> value;
+  BOOST_TEST(value == count);
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_CASE(test_compressed_sections)
+{
+  dbDatabase* db = createSimpleDB();
+  _dbDatabase* impl = reinterpret_cast<_dbDatabase*>(db);
+  const std::string path
+      = (std::filesystem::temp_directory_path() / "TestDbStreamCompressed")
+            .string();
+
+  const int count = 1 << 16;
+  const auto writer = [=](dbOStream& section) {
+    for (int i = 0; i < count; i++) {
+      section << i % 16;
+    }
+  };
+  FILE* write = fopen(path.c_str(), "w");
+  {
+    dbOStream stream(impl, write);
+    stream.setCompress(true);
+    // the outer section is stored as is, the inner ones are compressed
+    stream.writeSections({writer, [&](dbOStream& section) {
+                            section.writeSections({writer, writer});
+                          }});
+  }
+  fclose(write);
+  BOOST_TEST(std::filesystem::file_size(path) < count * sizeof(int));
+
+  std::ifstream read;
+  read.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  read.open(path.c_str(), std::ios::binary);
+  std::vector<char> same(3, false);
+  const auto reader = [=, &same](int idx) {
+    return [=, &same](dbIStream& section) {
+      bool ok = true;
+      for (int i = 0; i < count; i++) {
+        int value;
+        section >> value;
+        ok &= (value == i % 16);
+      }
+      same[idx] = ok;
+    };
+  };
+  dbIStream stream(impl, read);
+  stream.readSections({reader(0), [&](dbIStream& section) {
+                         section.readSections({reader(1), reader(2)});
+                       }});
+  for (char ok : same) {
+    BOOST_TEST(ok);
+  }
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_CASE(test_database_sections)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  const std::string path
+      = (std::filesystem::temp_directory_path() / "TestDbStreamDatabase")
+            .string();
+  FILE* write = fopen(path.c_str(), "w");
+  db->write(write, true);
+  fclose(write);
+  dbDatabase::destroy(db);
+
+  dbDatabase* db2 = dbDatabase::create();
+  std::ifstream read;
+  read.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  read.open(path.c_str(), std::ios::binary);
+  db2->read(read);
+  BOOST_TEST(db2->getTech()->findLayer("L1") != nullptr);
+  BOOST_TEST(db2->findLib("lib1")->findMaster("or2") != nullptr);
+  dbBlock* block = db2->getChip()->getBlock();
+  BOOST_TEST(block->getInsts().size() == 3);
+  BOOST_TEST(block->getNets().size() == 7);
+  BOOST_TEST(block->findInst("i3")->findITerm("o")->getNet()->getName()
+             == "n7");
+  dbDatabase::destroy(db2);
+}
+
+BOOST_AUTO_TEST_CASE(test_mapped_database)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  const std::string path
+      = (std::filesystem::temp_directory_path() / "TestDbStreamMapped")
+            .string();
+  FILE* write = fopen(path.c_str(), "w");
+  db->write(write);
+  fclose(write);
+  dbDatabase::destroy(db);
+
+  dbDatabase* db2 = dbDatabase::create();
+  db2->read(path.c_str());
+  BOOST_TEST(db2->getTech()->findLayer("L1") != nullptr);
+  BOOST_TEST(db2->findLib("lib1")->findMaster("or2") != nullptr);
+  dbBlock* block = db2->getChip()->getBlock();
+  BOOST_TEST(block->getInsts().size() == 3);
+  BOOST_TEST(block->findInst("i3")->findITerm("o")->getNet()->getName()
+             == "n7");
+  dbDatabase::destroy(db2);
+
+  // a truncated file is an error
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+  dbDatabase* db3 = dbDatabase::create();
+  BOOST_CHECK_THROW(db3->read(path.c_str()), std::runtime_error);
+  dbDatabase::destroy(db3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,11 @@
+# Read a routed DEF on 4 threads. read_def_threads.defok was written after
+# reading the same DEF on a single thread.
+source "helpers.tcl"
+
+set_thread_count 4
+read_lef "data/Nangate45/NangateOpenCellLibrary.mod.lef"
+read_def "data/gcd/gcd_nangate45_route.def"
+
+set def_file [make_result_file "read_def_threads.def"]
+write_def $def_file
+diff_files $def_file read_def_threads.defok
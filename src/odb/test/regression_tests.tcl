@@ -10,6 +10,7 @@ record_tests {
   dump_via_rules
   dump_vias
   read_def
+  read_def_threads
   dump_nets
   lef_mask
   write_lef_and_def
@@ -62,6 +62,7 @@ class Ext
                    const std::string& file,
                    int pattern);
   void bench_verilog(const std::string& file);
+  void bench_rule_lookups(const std::string& ext_model_file, int repeat);
 
   struct BenchWiresOptions
   {
@@ -108,7 +109,7 @@ class Ext
   {
     const char* debug_net = nullptr;
     const char* ext_model_file = nullptr;
-    const char* const net = nullptr;
+    const char* net = nullptr;
     const int cc_up = 2;
     int corner_cnt = 1;
     double max_res = 50.0;
@@ -117,6 +118,8 @@ class Ext
     int context_depth = 5;
     int cc_model = 10;
     bool lef_res = false;
+    int thread_count = 1;
+    bool incremental = false;
   };
 
   void extract(ExtractOptions options);
@@ -148,7 +151,7 @@ class Ext
     const bool term_junction_xy = false;
     const bool single_pi = false;
     const char* file = nullptr;
-    const bool gz = false;
+    bool gz = false;
     const bool stop_after_map = false;
     const bool w_clock = false;
     const bool w_conn = false;
@@ -159,6 +162,7 @@ class Ext
     const bool no_backslash = false;
     const char* cap_units = "PF";
     const char* res_units = "OHM";
+    int thread_count = 1;
   };
   void write_spef(const SpefOptions& options);
 
@@ -190,6 +194,7 @@ class Ext
     bool no_cap_num_collapse = false;
     const char* cap_node_map_file = nullptr;
     bool log = false;
+    int thread_count = 1;
   };
 
   void read_spef(ReadSpefOpts& opt);
@@ -33,9 +33,11 @@
 #pragma once
 
 #include <map>
+#include <vector>
 
 #include "ZObject.h"
 #include "db.h"
+#include "dbBlockCallBackObj.h"
 #include "dbExtControl.h"
 #include "dbShape.h"
 #include "dbUtil.h"
@@ -132,9 +134,10 @@ class extDistRCTable
   extDistRC* getRC_index(int n);
   extDistRC* getComputeRC(double dist);
   extDistRC* getComputeRC(uint dist);
+  extDistRC* getComputeRC_indexed(uint dist);
   extDistRC* getRC(uint s, bool compute);
   extDistRC* getComputeRC_res(uint dist1, uint dist2);
-  extDistRC* findIndexed_res(uint dist1, uint dist2);
+  extDistRC* findIndexed_res(uint index_dist, uint dist1, uint dist2);
   int getComputeRC_maxDist();
   uint writeRules(FILE* fp,
                   Ath__array1D<extDistRC*>* table,
@@ -166,6 +169,8 @@ class extDistRCTable
                       bool ignore,
                       double dbFactor = 1.0);
   uint interpolate(uint distUnit, int maxDist, AthPool<extDistRC>* rcPool);
+  void makeFlatTable();
+  uint getBenchMaxDist();
   uint mapInterpolate(extDistRC* rc1,
                       extDistRC* rc2,
                       uint distUnit,
@@ -179,6 +184,7 @@ class extDistRCTable
  private:
   void makeCapTableOver();
   void makeCapTableUnder();
+  static extDistRC* getResCopy(extDistRC* rc, double diag);
 
   Ath__array1D<extDistRC*>* _measureTable;
   Ath__array1D<extDistRC*>* _computeTable;
@@ -188,6 +194,17 @@ class extDistRCTable
   uint _distCnt;
   uint _unit;
   Logger* logger_;
+
+  // _computeTable values stored by value and the measured entries that
+  // getComputeRC returns outside of its range, set by makeFlatTable
+  std::vector<extDistRC> _flatTable;
+  extDistRC* _flatFirstRC;
+  extDistRC* _flatLastRC;
+  extDistRC* _flatInfRC;  // last before 99000 when the last sep is 100000
+  extDistRC* _flatInfRC2;
+  extDistRC* _flatInfRC3;
+  uint _flatFirstDist;
+  uint _flatLastDist;
 };
 
 class extDistWidthRCTable
@@ -311,7 +328,6 @@ class extDistWidthRCTable
   uint _metCnt;  // if _over==false _metCnt???
 
   AthPool<extDistRC>* _rcPoolPtr;
-  extDistRC* _rc31;
 };
 
 class extMetRCTable
@@ -870,8 +886,8 @@ class extMeasure
                    uint trackn,
                    Ath__array1D<odb::SEQ*>* diagTable);
 
-  odb::dbCCSeg* makeCcap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double ccCap);
-  void addCCcap(odb::dbCCSeg* ccap, double v, uint model);
+  bool makeCcap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double ccCap);
+  void addCCcap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double v, uint model);
   void addFringe(odb::dbRSeg* rseg1,
                  odb::dbRSeg* rseg2,
                  double frCap,
@@ -1241,6 +1257,86 @@ class extCorner
   extCorner* _extCornerPtr;
 };
 
+// Parasitics computed by one thread of a multithreaded coupling flow. They
+// are applied to the db once all threads are done, in the same order as a
+// single threaded extraction would have applied them.
+class extBandJournal
+{
+ public:
+  void addCapacitance(odb::dbRSeg* rseg, double cap, int dbIndex);
+  void addResistance(odb::dbRSeg* rseg, double res, int dbIndex);
+  void addCoupling(odb::dbCapNode* node1,
+                   odb::dbCapNode* node2,
+                   double cap,
+                   int dbIndex);
+  void clear() { _entries.clear(); }
+  void apply() const;
+
+ private:
+  enum Type
+  {
+    CAPACITANCE,
+    RESISTANCE,
+    COUPLING
+  };
+  struct Entry
+  {
+    Type type;
+    int dbIndex;
+    odb::dbObject* obj1;
+    odb::dbObject* obj2;
+    double value;
+  };
+  std::vector<Entry> _entries;
+};
+
+// Flags the nets whose wires are edited after an extraction as wire altered,
+// so that an incremental extraction knows which nets to extract again. The
+// shapes they had when they were extracted are kept as the nets that were
+// near them may have to be extracted again too.
+class extNetTracker : public odb::dbBlockCallBackObj
+{
+ public:
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbITermPostDisconnect(odb::dbITerm* iterm, odb::dbNet* net) override;
+  void inDbBTermPostConnect(odb::dbBTerm* bterm) override;
+  void inDbBTermPostDisConnect(odb::dbBTerm* bterm, odb::dbNet* net) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePreModify(odb::dbWire* wire) override;
+  void inDbWirePreAttach(odb::dbWire* wire, odb::dbNet* net) override;
+  void inDbWirePreDetach(odb::dbWire* wire) override;
+  void inDbWirePreAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbWirePreCopy(odb::dbWire* src, odb::dbWire* dst) override;
+
+  // Moves the extracted shapes of the nets, and of the altered nets that
+  // were destroyed since, to shapes.
+  void takeShapes(std::vector<odb::dbNet*>& nets,
+                  std::vector<odb::dbShape>& shapes);
+  void clear();
+
+ private:
+  void alter(odb::dbNet* net);
+
+  std::map<odb::dbNet*, std::vector<odb::dbShape>> _shapes;
+  std::vector<odb::dbShape> _destroyedShapes;
+};
+
+// Extent and layer tables of the bands swept by couplingFlow.
+struct extBandGeometry
+{
+  int ll[2];
+  int ur[2];
+  uint layerCnt;
+  uint ccDist;
+  uint maxPitch;
+  uint step[2];
+  uint pitchTable[32];
+  uint widthTable[32];
+  uint dirTable[32];
+};
+
 class extMain
 {
  public:
@@ -1361,6 +1457,37 @@ class extMain
                     uint ccDist,
                     extMeasure* m,
                     CoupleAndCompute coupleAndCompute);
+  void initCouplingSearch(odb::Rect& extRect,
+                          uint ccDist,
+                          extMeasure* m,
+                          extBandGeometry& geom);
+  int extractBand(extBandGeometry& geom,
+                  int dir,
+                  int loXY,
+                  int hiXY,
+                  int gsLimit,
+                  extMeasure* m,
+                  CoupleAndCompute coupleAndCompute,
+                  int** limitArray,
+                  uint& wireCnt);
+  void reportExtractProgress(uint totalWiresExtracted, uint totWireCnt);
+  void couplingFlowThreads(odb::Rect& extRect,
+                           extBandGeometry& geom,
+                           uint maxWidth,
+                           uint totWireCnt,
+                           CoupleAndCompute coupleAndCompute);
+  void extractBands(odb::Rect& extRect,
+                    extBandGeometry& geom,
+                    int dir,
+                    const std::vector<int>& bands,
+                    int first,
+                    int last,
+                    int margin,
+                    CoupleAndCompute coupleAndCompute,
+                    extBandJournal* journal,
+                    uint& wireCnt);
+  void initCouplingWorker(extMain* main);
+  void initCouplingMeasure(extMeasure* m);
   uint initPlanes(uint dir,
                   int* wLL,
                   int* wUR,
@@ -1424,9 +1551,15 @@ class extMain
   double getFringe(uint met, uint width, uint modelIndex, double& areaCap);
   void printNet(odb::dbNet* net, uint netId);
   double calcFringe(extDistRC* rc, double deltaFr, bool includeCoupling);
-  double updateTotalCap(odb::dbRSeg* rseg, double cap, uint modelIndex);
+  void updateTotalCap(odb::dbRSeg* rseg, double cap, uint modelIndex);
   bool updateCoupCap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, int jj, double v);
-  double updateRes(odb::dbRSeg* rseg, double res, uint model);
+  void updateRes(odb::dbRSeg* rseg, double res, uint model);
+  void addRSegCapacitance(odb::dbRSeg* rseg, double cap, int dbIndex);
+  void addRSegResistance(odb::dbRSeg* rseg, double res, int dbIndex);
+  void addCCCapacitance(odb::dbRSeg* rseg1,
+                        odb::dbRSeg* rseg2,
+                        double cap,
+                        int dbIndex);
 
   uint getExtBbox(int* x1, int* y1, int* x2, int* y2);
 
@@ -1472,7 +1605,13 @@ class extMain
                        bool mergeViaRes,
                        double ccThres,
                        int contextDepth,
-                       const char* extRules);
+                       const char* extRules,
+                       bool incremental = false);
+  bool getIncrementalNets(const char* netNames,
+                          std::vector<odb::dbNet*>& nets);
+  void addCouplingNeighbors(std::vector<odb::dbNet*>& nets,
+                            std::vector<odb::dbShape>& shapes,
+                            std::vector<odb::dbNet*>& neighbors);
 
   uint getShortSrcJid(uint jid);
   void make1stRSeg(odb::dbNet* net,
@@ -1543,7 +1682,8 @@ class extMain
                 bool moreToRead = false,
                 bool diff = false,
                 bool calib = false,
-                int app_ptint_limit = 0);
+                int app_ptint_limit = 0,
+                int threads = 1);
   uint readSPEFincr(char* filename);
   uint writeSPEF(bool stop);
   uint writeSPEF(uint netId,
@@ -1571,13 +1711,15 @@ class extMain
                  bool no_backslash,
                  int corner,
                  const char* corner_name,
-                 bool parallel);
+                 bool parallel,
+                 int threads = 1);
   uint writeNetSPEF(odb::dbNet* net, double resBound, uint debug);
   uint makeITermCapNode(uint id, odb::dbNet* net);
   uint makeBTermCapNode(uint id, odb::dbNet* net);
 
   double getTotalNetCap(uint netId, uint cornerNum);
   void initContextArray();
+  void removeContextArray();
   void initDgContextArray();
   void removeDgContextArray();
 
@@ -1588,6 +1730,7 @@ class extMain
                   const char* rulesFile,
                   int pattern);
   uint benchWires(extMainOptions* options);
+  uint benchRuleLookups(const char* rulesFileName, uint repeat);
   uint genExtRules(const char* rulesFileName, int pattern);
   int getExtCornerIndex(odb::dbBlock* block, const char* cornerName);
 
@@ -1606,7 +1749,7 @@ class extMain
   void cleanCornerTables();
   int getDbCornerIndex(const char* name);
   int getDbCornerModel(const char* name);
-  bool setCorners(const char* rulesFileName);
+  bool setCorners(const char* rulesFileName, bool keepParasitics = false);
   int getProcessCornerDbIndex(int pcidx);
   void getScaledCornerDbIndex(int pcidx, int& sidx, int& scdbIdx);
   void getScaledRC(int sidx, double& res, double& cap);
@@ -2069,6 +2212,7 @@ class extMain
   bool _useDbSdb;
 
   Ath__array1D<int>* _nodeTable;
+  int _capNodeOneJunction = -1;  // branch junction of cap node 1
   Ath__array1D<int>* _btermTable;
   Ath__array1D<int>* _itermTable;
 
@@ -2219,6 +2363,11 @@ class extMain
   uint _debug_net_id;
   float _previous_percent_extracted;
 
+  // Set on the workers of a multithreaded coupling flow.
+  extBandJournal* _bandJournal;
+
+  extNetTracker _netTracker;
+
   double _minCapTable[64][64];
   double _maxCapTable[64][64];
   double _minResTable[64][64];
@@ -2228,6 +2377,7 @@ class extMain
 
  public:
   bool _lef_res;
+  int _threads;
   std::string _tmpLenStats;
   int _last_node_xy[2];
   bool _wireInfra;
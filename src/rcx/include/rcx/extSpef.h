@@ -33,6 +33,8 @@
 #pragma once
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include "array1.h"
 #include "db.h"
@@ -138,6 +140,9 @@ class extSpef
   uint readBlockIncr(uint debug);
 
   bool setOutSpef(char* filename);
+  // Write (format and compress) or read (split into words) the *D_NET
+  // sections on this many threads.
+  void setThreads(int threads);
   bool closeOutFile();
   void setGzipFlag(bool gzFlag);
   bool setInSpef(char* filename, bool onlyOpen = false);
@@ -354,11 +359,118 @@ class extSpef
     C_ON
   };
 
+  void initNetWriter(extSpef* spef);
+  uint writeNets(std::vector<odb::dbNet*>& nets, uint repChunk);
+  void reportNetsFinished(uint cnt);
+  std::string writeNetChunk(std::vector<odb::dbNet*>& nets,
+                            uint first,
+                            uint last,
+                            uint baseNameMap);
+  std::string gzipMember(const char* text, size_t size);
+  void flushOutBuffer();
+
+  // A node word split at the delimiter as _nodeParser splits it, pin is
+  // nullptr for a port.
+  struct SpefNode
+  {
+    char* word;
+    int tokenCnt;
+    char* name;
+    char* pin;
+  };
+  // The values of a cap or res line, from DNetChunk::values[first].
+  struct SpefValues
+  {
+    uint first;
+    uint cnt;
+  };
+  // A *CAP line, a coupling cap if node2.word is set.
+  struct StagedCap
+  {
+    SpefNode node1;
+    SpefNode node2;
+    SpefValues values;
+  };
+  struct StagedRes
+  {
+    SpefNode node1;
+    SpefNode node2;
+    SpefValues values;
+    int line;  // lines after the *D_NET line
+  };
+  // A *D_NET section parsed on a worker thread, addDNet makes its db objects
+  // as readDNet does from the words.
+  struct StagedDNet
+  {
+    char* dnet;  // the *D_NET word
+    char* name;
+    std::vector<StagedCap> caps;
+    std::vector<StagedRes> res;
+    bool capEnd;  // ends in the *CAP section
+    int endLine;  // lines from *D_NET to *END
+  };
+
+  // Whole *D_NET sections of the mapped input file, split into words in
+  // place.  The line numbers are counted from the start of the chunk.  The
+  // sections that have the plain *CONN, *CAP and *RES layout are staged,
+  // the others are read from the words.
+  struct DNetChunk
+  {
+    char* begin;
+    char* end;
+    int lineCnt;
+    std::vector<char*> words;
+    std::vector<int> lineStarts;
+    std::vector<int> lineNums;
+    std::vector<StagedDNet> dnets;
+    std::vector<char> text;  // the node names and pins
+    std::vector<double> values;
+  };
+
+  void readDNets(uint debug, uint& cnt, bool& doSortingRSeg);
+  bool readMappedDNets(uint debug, uint& cnt, bool& doSortingRSeg);
+  static void splitDNetChunk(DNetChunk& chunk);
+  static void stageDNets(DNetChunk& chunk,
+                         const char* separators,
+                         uint minValues);
+  static bool stageDNet(DNetChunk& chunk,
+                        int line,
+                        const char* separators,
+                        uint minValues,
+                        StagedDNet& dnet);
+  static bool stageNode(DNetChunk& chunk,
+                        char* word,
+                        const char* separators,
+                        SpefNode& node);
+  static bool stageValues(DNetChunk& chunk,
+                          const char* word,
+                          const char* separators,
+                          uint minValues,
+                          SpefValues& values);
+  StagedDNet* findStagedDNet();
+  uint addDNet(const StagedDNet& dnet);
+  bool getCapNode(const SpefNode& node,
+                  uint* netId,
+                  uint& capId,
+                  odb::dbNet*& cornerNet,
+                  odb::dbCapNode*& cap);
+  void setCapValues(odb::dbCapNode* cap, const SpefValues& values);
+
   char _inFile[1024];
   FILE* _inFP;
+  // The chunk the *D_NET sections are read from and its next staged one.
+  DNetChunk* _dnetChunk;
+  uint _nextDNet;
 
   char _outFile[1024];
   FILE* _outFP;
+  // With gzip on several threads the sections are compressed in memory and
+  // written to _gzFP as separate gzip members, _outFP is then a memory
+  // stream into _outBuf.
+  FILE* _gzFP;
+  char* _outBuf;
+  size_t _outBufSize;
+  int _threads;
 
   Ath__parser* _parser;
 
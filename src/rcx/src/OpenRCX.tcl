@@ -61,6 +61,8 @@ sta::define_cmd_args "extract_parasitics" {
     [-cc_model track]
     [-context_depth depth]
     [-no_merge_via_res]
+    [-incremental]
+    [-nets nets]
 }
 
 proc extract_parasitics { args } {
@@ -71,8 +73,9 @@ proc extract_parasitics { args } {
         -coupling_threshold
         -debug_net_id
         -context_depth
-        -cc_model } \
-      flags { -lef_res }
+        -cc_model
+        -nets } \
+      flags { -lef_res -incremental }
 
   set ext_model_file ""
   if { [info exists keys(-ext_model_file)] } {
@@ -116,19 +119,30 @@ proc extract_parasitics { args } {
     set debug_net_id $keys(-debug_net_id)
   }
 
+  set incremental [info exists flags(-incremental)]
+  set nets ""
+  if { [info exists keys(-nets)] } {
+    if { !$incremental } {
+      utl::error RCX 403 "-nets requires -incremental."
+    }
+    set nets $keys(-nets)
+  }
+
   rcx::extract $ext_model_file $corner_cnt $max_res \
       $coupling_threshold $cc_model \
-      $depth $debug_net_id $lef_res $no_merge_via_res
+      $depth $debug_net_id $lef_res $no_merge_via_res \
+      $incremental $nets [thread_count]
 }
 
 sta::define_cmd_args "write_spef" { 
   [-net_id net_id]
-  [-nets nets] filename }
+  [-nets nets]
+  [-gz] filename }
 
 proc write_spef { args } {
   sta::parse_key_args "write_spef" args keys \
       { -net_id 
-        -nets }
+        -nets } flags { -gz }
   sta::check_argc_eq1 "write_spef" $args
 
   set spef_file $args
@@ -143,7 +157,9 @@ proc write_spef { args } {
     set net_id $keys(-net_id)
   }
 
-  rcx::write_spef $spef_file $nets $net_id
+  set gz [info exists flags(-gz)]
+
+  rcx::write_spef $spef_file $nets $net_id $gz [thread_count]
 }
 
 sta::define_cmd_args "adjust_rc" {
@@ -284,11 +300,33 @@ proc bench_verilog { args } {
   rcx::bench_verilog $args
 }
 
+sta::define_cmd_args "bench_rule_lookups" {
+    -ext_model_file filename
+    [-repeat count]
+}
+
+proc bench_rule_lookups { args } {
+  sta::parse_key_args "bench_rule_lookups" args keys \
+      { -ext_model_file -repeat } flags {}
+
+  if { ![info exists keys(-ext_model_file)] } {
+    utl::error RCX 454 "bench_rule_lookups -ext_model_file is required."
+  }
+
+  set repeat 100
+  if { [info exists keys(-repeat)] } {
+    set repeat $keys(-repeat)
+    sta::check_positive_integer "-repeat" $repeat
+  }
+
+  rcx::bench_rule_lookups $keys(-ext_model_file) $repeat
+}
+
 sta::define_cmd_args "bench_read_spef" { filename }
 
 proc bench_read_spef { args } {
   sta::check_argc_eq1 "bench_read_spef" $args
-  rcx::read_spef $args
+  rcx::read_spef $args [thread_count]
 }
 
 sta::define_cmd_args "write_rules" {
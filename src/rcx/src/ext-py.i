@@ -55,9 +55,16 @@ void extract(const char* ext_model_file,
              int context_depth,
              const char* debug_net_id,
              bool lef_res,
-             bool no_merge_via_res);
+             bool no_merge_via_res,
+             bool incremental,
+             const char* nets,
+             int thread_count);
 
-void write_spef(const char* file, const char* nets, int net_id);
+void write_spef(const char* file,
+                const char* nets,
+                int net_id,
+                bool gz,
+                int thread_count);
 
 void adjust_rc(double res_factor,
                double cc_factor,
@@ -84,12 +91,14 @@ void bench_wires(bool db_only,
 
 void bench_verilog(const char* file);
 
+void bench_rule_lookups(const char* ext_model_file, int repeat);
+
 void write_rules(const char* file,
                  const char* dir,
                  const char* name,
                  int pattern);
 
-void read_spef(const char* file);
+void read_spef(const char* file, int thread_count);
 
 %}
 
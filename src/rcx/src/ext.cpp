@@ -178,6 +178,11 @@ void Ext::bench_verilog(const std::string& file)
   _ext->benchVerilog(fp);
 }
 
+void Ext::bench_rule_lookups(const std::string& ext_model_file, int repeat)
+{
+  _ext->benchRuleLookups(ext_model_file.c_str(), repeat);
+}
+
 void Ext::define_process_corner(int ext_model_index, const std::string& name)
 {
   _ext->setBlockFromChip();
@@ -237,6 +242,7 @@ void Ext::extract(ExtractOptions opts)
 
   _ext->set_debug_nets(opts.debug_net);
   _ext->_lef_res = opts.lef_res;
+  _ext->_threads = opts.thread_count;
 
   _ext->makeBlockRCsegs(opts.net,
                         opts.cc_up,
@@ -245,7 +251,8 @@ void Ext::extract(ExtractOptions opts)
                         !opts.no_merge_via_res,
                         opts.coupling_threshold,
                         opts.context_depth,
-                        opts.ext_model_file);
+                        opts.ext_model_file,
+                        opts.incremental);
 
   logger_->info(
       RCX, 15, "Finished extracting {}.", _ext->getBlock()->getName().c_str());
@@ -301,7 +308,8 @@ void Ext::write_spef(const SpefOptions& opts)
                   opts.no_backslash,
                   opts.corner,
                   name,
-                  opts.parallel);
+                  opts.parallel,
+                  opts.thread_count);
 
   logger_->info(RCX, 17, "Finished writing SPEF ...");
 }
@@ -352,7 +360,8 @@ void Ext::read_spef(ReadSpefOpts& opt)
                  opt.more_to_read,
                  false /*diff*/,
                  false /*calibrate*/,
-                 opt.app_print_limit);
+                 opt.app_print_limit,
+                 opt.thread_count);
 
   for (int ii = 1; ii < parser.getWordCnt(); ii++)
     _ext->readSPEFincr(parser.get(ii));
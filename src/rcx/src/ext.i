@@ -70,7 +70,10 @@ extract(const char* ext_model_file,
         int context_depth,
         const char* debug_net_id,
         bool lef_res,
-        bool no_merge_via_res)
+        bool no_merge_via_res,
+        bool incremental,
+        const char* nets,
+        int thread_count)
 {
   Ext* ext = getOpenRCX();
   Ext::ExtractOptions opts;
@@ -84,6 +87,9 @@ extract(const char* ext_model_file,
   opts.lef_res = lef_res;
   opts.debug_net = debug_net_id;
   opts.no_merge_via_res = no_merge_via_res;
+  opts.incremental = incremental;
+  opts.net = nets;
+  opts.thread_count = thread_count;
   
   ext->extract(opts);
 }
@@ -91,13 +97,17 @@ extract(const char* ext_model_file,
 void
 write_spef(const char* file,
            const char* nets,
-           int net_id)
+           int net_id,
+           bool gz,
+           int thread_count)
 {
   Ext* ext = getOpenRCX();
   Ext::SpefOptions opts;
   opts.file = file;
   opts.nets = nets;
   opts.net_id = net_id;
+  opts.gz = gz;
+  opts.thread_count = thread_count;
   
   ext->write_spef(opts);
 }
@@ -169,6 +179,13 @@ bench_verilog(const char* file)
   ext->bench_verilog(file);
 }
 
+void
+bench_rule_lookups(const char* ext_model_file, int repeat)
+{
+  Ext* ext = getOpenRCX();
+  ext->bench_rule_lookups(ext_model_file, repeat);
+}
+
 void
 write_rules(const char* file,
             const char* dir,
@@ -181,11 +198,12 @@ write_rules(const char* file,
 }
 
 void 
-read_spef(const char* file)
+read_spef(const char* file, int thread_count)
 {
   Ext* ext = getOpenRCX();
   Ext::ReadSpefOpts opts;
   opts.file = file;
+  opts.thread_count = thread_count;
   
   ext->read_spef(opts);
 }
@@ -30,13 +30,16 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <map>
+#include <random>
 #include <vector>
 
 #include "rcx/extRCap.h"
 #include "rcx/extSpef.h"
 #include "rcx/extprocess.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 namespace rcx {
 
@@ -534,6 +537,78 @@ uint extMain::benchWires(extMainOptions* opt)
   return 0;
 }
 
+uint extDistRCTable::getBenchMaxDist()
+{
+  if (_flatFirstRC == NULL)
+    return 0;
+
+  // past twice the last distance to go through every branch of the lookup
+  return 2 * _flatLastDist + _unit;
+}
+
+uint extMain::benchRuleLookups(const char* rulesFileName, uint repeat)
+{
+  extRCModel* model = new extRCModel("MINTYPMAX", logger_);
+  if (!model->readRules(
+          (char*) rulesFileName, false, true, true, true, true)) {
+    logger_->warn(
+        RCX, 450, "Can't read extraction model file {}", rulesFileName);
+    delete model;
+    return 0;
+  }
+  extMetRCTable* rcModel = model->getMetRCTable(0);
+
+  // every distance of the tables the measure code looks up for over, under
+  // and over/under coupling, in random order like the measured wires
+  std::vector<std::pair<extDistRCTable*, uint>> lookups;
+  for (uint met = 1; met < rcModel->_layerCnt; met++) {
+    extDistWidthRCTable* widthTables[3] = {rcModel->_capOver[met],
+                                           rcModel->_capUnder[met],
+                                           rcModel->_capOverUnder[met]};
+    for (extDistWidthRCTable* w : widthTables) {
+      if (w == NULL || w->_rcDistTable == NULL)
+        continue;
+      for (uint mou = 0; mou < w->_metCnt; mou++) {
+        for (uint ii = 0; ii < w->_widthTable->getCnt(); ii++) {
+          extDistRCTable* table = w->_rcDistTable[mou][ii];
+          uint maxDist = table->getBenchMaxDist();
+          for (uint dist = 0; dist < maxDist; dist++)
+            lookups.push_back({table, dist});
+        }
+      }
+    }
+  }
+  std::mt19937 rand(1);
+  std::shuffle(lookups.begin(), lookups.end(), rand);
+
+  double sum[2] = {0.0, 0.0};
+  for (int flat = 0; flat < 2; flat++) {
+    utl::Timer timer;
+    for (uint ii = 0; ii < repeat; ii++) {
+      for (auto& [table, dist] : lookups) {
+        extDistRC* rc = flat ? table->getComputeRC(dist)
+                             : table->getComputeRC_indexed(dist);
+        if (rc != NULL)
+          sum[flat] += rc->_coupling + rc->_fringe + rc->_res;
+      }
+    }
+    double time = timer.elapsed();
+    uint64_t cnt = (uint64_t) repeat * lookups.size();
+    logger_->info(RCX,
+                  453,
+                  "{} {} rule lookups in {:.3f} sec, {:.1f} M/sec",
+                  flat ? "Flat table:" : "Pointer table:",
+                  cnt,
+                  time,
+                  time > 0 ? cnt / time / 1e6 : 0.0);
+  }
+  if (sum[0] != sum[1])
+    logger_->warn(RCX, 446, "Flat rule tables do not match the rules.");
+
+  delete model;
+  return lookups.size();
+}
+
 uint extMain::runSolver(extMainOptions* opt, uint netId, int shapeId)
 {
   extRCModel* m = new extRCModel("TYPICAL", logger_);
@@ -660,9 +660,9 @@ void Ath__track::buildDgContext(Ath__array1D<SEQ*>* dgContext,
 
 void Ath__grid::buildDgContext(int gridn, int base)
 {
-  static Ath__wire** allCtxwire = NULL;
-  static int awcnt;
-  static int awsize;
+  static thread_local Ath__wire** allCtxwire = NULL;
+  static thread_local int awcnt;
+  static thread_local int awsize;
   if (allCtxwire == NULL) {
     allCtxwire = (Ath__wire**) calloc(sizeof(Ath__wire*), 4096);
     awsize = 4096;
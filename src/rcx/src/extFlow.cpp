@@ -30,12 +30,14 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
 #include "dbUtil.h"
 #include "rcx/extRCap.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 #include "wire.h"
 
 namespace rcx {
@@ -1106,44 +1108,36 @@ uint extMain::fill_gs4(int dir,
   return pcnt + scnt;
 }
 
-uint extMain::couplingFlow(Rect& extRect,
-                           uint ccFlag,
-                           extMeasure* m,
-                           CoupleAndCompute coupleAndCompute)
+void extMain::initCouplingSearch(Rect& extRect,
+                                 uint ccDist,
+                                 extMeasure* m,
+                                 extBandGeometry& geom)
 {
-  uint ccDist = ccFlag;
-
-  uint sigtype = 9;
-  uint pwrtype = 11;
-
-  uint pitchTable[32];
-  uint widthTable[32];
   for (uint ii = 0; ii < 32; ii++) {
-    pitchTable[ii] = 0;
-    widthTable[ii] = 0;
+    geom.pitchTable[ii] = 0;
+    geom.widthTable[ii] = 0;
+    geom.dirTable[ii] = 0;
   }
-  uint dirTable[16];
   int baseX[32];
   int baseY[32];
-  uint layerCnt = initSearchForNets(
-      baseX, baseY, pitchTable, widthTable, dirTable, extRect, false);
-
-  uint maxPitch = pitchTable[layerCnt - 1];
-
-  layerCnt = (int) layerCnt > _currentModel->getLayerCnt()
-                 ? layerCnt
-                 : _currentModel->getLayerCnt();
-  int ll[2];
-  int ur[2];
-  ll[0] = extRect.xMin();
-  ll[1] = extRect.yMin();
-  ur[0] = extRect.xMax();
-  ur[1] = extRect.yMax();
-
-  int lo_gs[2];
-  int hi_gs[2];
-  int lo_sdb[2];
-  int hi_sdb[2];
+  uint layerCnt = initSearchForNets(baseX,
+                                    baseY,
+                                    geom.pitchTable,
+                                    geom.widthTable,
+                                    geom.dirTable,
+                                    extRect,
+                                    false);
+
+  geom.maxPitch = geom.pitchTable[layerCnt - 1];
+
+  geom.layerCnt = (int) layerCnt > _currentModel->getLayerCnt()
+                      ? layerCnt
+                      : _currentModel->getLayerCnt();
+  geom.ccDist = ccDist;
+  geom.ll[0] = extRect.xMin();
+  geom.ll[1] = extRect.yMin();
+  geom.ur[0] = extRect.xMax();
+  geom.ur[1] = extRect.yMax();
 
   Ath__overlapAdjust overlapAdj = Z_noAdjust;
   _useDbSdb = true;
@@ -1153,7 +1147,7 @@ uint extMain::couplingFlow(Rect& extRect,
                          _CCnoPowerSource,
                          _CCnoPowerTarget,
                          _ccUp,
-                         _allNet,
+                         true,  // the wires of all nets are searched
                          _ccContextDepth,
                          _ccContextArray,
                          _dgContextArray,
@@ -1170,6 +1164,81 @@ uint extMain::couplingFlow(Rect& extRect,
                          m->_seqPool);
 
   _seqPool = m->_seqPool;
+}
+
+int extMain::extractBand(extBandGeometry& geom,
+                         int dir,
+                         int loXY,
+                         int hiXY,
+                         int gsLimit,
+                         extMeasure* m,
+                         CoupleAndCompute coupleAndCompute,
+                         int** limitArray,
+                         uint& wireCnt)
+{
+  uint sigtype = 9;
+  uint pwrtype = 11;
+
+  int lo_gs[2];
+  int hi_gs[2];
+  int lo_sdb[2];
+  int hi_sdb[2];
+
+  lo_gs[!dir] = geom.ll[!dir];
+  hi_gs[!dir] = geom.ur[!dir];
+  lo_sdb[!dir] = geom.ll[!dir];
+  hi_sdb[!dir] = geom.ur[!dir];
+
+  lo_gs[dir] = gsLimit;
+  hi_gs[dir] = hiXY;
+
+  fill_gs4(dir,
+           geom.ll,
+           geom.ur,
+           lo_gs,
+           hi_gs,
+           geom.layerCnt,
+           geom.dirTable,
+           geom.pitchTable,
+           geom.widthTable);
+
+  m->_rotatedGs = getRotatedFlag();
+  m->_pixelTable = _geomSeq;
+
+  // add wires onto search such that    loX<=loX<=hiX
+  lo_sdb[dir] = loXY;
+  hi_sdb[dir] = hiXY;
+
+  wireCnt = 0;
+  wireCnt += addPowerNets(dir, lo_sdb, hi_sdb, pwrtype);
+  wireCnt += addSignalNets(dir, lo_sdb, hi_sdb, sigtype);
+
+  uint extractedWireCnt = 0;
+  int extractLimit = hiXY - geom.ccDist * geom.maxPitch;
+  return _search->couplingCaps(extractLimit,
+                               geom.ccDist,
+                               dir,
+                               extractedWireCnt,
+                               coupleAndCompute,
+                               m,
+                               _getBandWire,
+                               limitArray);
+}
+
+uint extMain::couplingFlow(Rect& extRect,
+                           uint ccFlag,
+                           extMeasure* m,
+                           CoupleAndCompute coupleAndCompute)
+{
+  uint ccDist = ccFlag;
+
+  extBandGeometry geom;
+  initCouplingSearch(extRect, ccDist, m, geom);
+
+  uint maxPitch = geom.maxPitch;
+  uint layerCnt = geom.layerCnt;
+  int* ll = geom.ll;
+  int* ur = geom.ur;
 
   uint maxWidth = 0;
   uint totPowerWireCnt = powerWireCounter(maxWidth);
@@ -1179,20 +1248,22 @@ uint extMain::couplingFlow(Rect& extRect,
   logger_->info(RCX, 43, "{} wires to be extracted", totWireCnt);
 
   uint minRes[2];
-  minRes[1] = pitchTable[1];
-  minRes[0] = widthTable[1];
+  minRes[1] = geom.pitchTable[1];
+  minRes[0] = geom.widthTable[1];
 
   const uint trackStep = 1000;
-  uint step_nm[2];
+  uint* step_nm = geom.step;
   step_nm[1] = trackStep * minRes[1];
   step_nm[0] = trackStep * minRes[1];
   if (maxWidth > ccDist * maxPitch) {
     step_nm[1] = ur[1] - ll[1];
     step_nm[0] = ur[0] - ll[0];
   }
-  // _use_signal_tables
-  Ath__array1D<uint> sdbPowerTable;
-  Ath__array1D<uint> tmpNetIdTable(64000);
+
+  if (_threads > 1 || !_allNet) {
+    couplingFlowThreads(extRect, geom, maxWidth, totWireCnt, coupleAndCompute);
+    return 0;
+  }
 
   uint totalWiresExtracted = 0;
 
@@ -1214,17 +1285,12 @@ uint extMain::couplingFlow(Rect& extRect,
     if (dir == 0)
       enableRotatedFlag();
 
-    lo_gs[!dir] = ll[!dir];
-    hi_gs[!dir] = ur[!dir];
-    lo_sdb[!dir] = ll[!dir];
-    hi_sdb[!dir] = ur[!dir];
-
     int minExtracted = ll[dir];
     int gs_limit = ll[dir];
 
     _search->initCouplingCapLoops(dir, ccFlag, coupleAndCompute, m);
 
-    lo_sdb[dir] = ll[dir] - step_nm[dir];
+    int loXY = ll[dir] - step_nm[dir];
     int hiXY = ll[dir] + step_nm[dir];
     if (hiXY > ur[dir])
       hiXY = ur[dir];
@@ -1234,40 +1300,18 @@ uint extMain::couplingFlow(Rect& extRect,
       if (ur[dir] - hiXY <= (int) step_nm[dir])
         hiXY = ur[dir] + 5 * ccDist * maxPitch;
 
-      lo_gs[dir] = gs_limit;
-      hi_gs[dir] = hiXY;
-
-      fill_gs4(dir,
-               ll,
-               ur,
-               lo_gs,
-               hi_gs,
-               layerCnt,
-               dirTable,
-               pitchTable,
-               widthTable);
-
-      m->_rotatedGs = getRotatedFlag();
-      m->_pixelTable = _geomSeq;
-
-      // add wires onto search such that    loX<=loX<=hiX
-      hi_sdb[dir] = hiXY;
-
       uint processWireCnt = 0;
-      processWireCnt += addPowerNets(dir, lo_sdb, hi_sdb, pwrtype);
-      processWireCnt += addSignalNets(dir, lo_sdb, hi_sdb, sigtype);
+      minExtracted = extractBand(geom,
+                                 dir,
+                                 loXY,
+                                 hiXY,
+                                 gs_limit,
+                                 m,
+                                 coupleAndCompute,
+                                 limitArray,
+                                 processWireCnt);
 
-      uint extractedWireCnt = 0;
       int extractLimit = hiXY - ccDist * maxPitch;
-      minExtracted = _search->couplingCaps(extractLimit,
-                                           ccFlag,
-                                           dir,
-                                           extractedWireCnt,
-                                           coupleAndCompute,
-                                           m,
-                                           _getBandWire,
-                                           limitArray);
-
       int deallocLimit = minExtracted - (ccDist + 1) * maxPitch;
       if (_printBandInfo)
         fprintf(bandinfo,
@@ -1280,24 +1324,12 @@ uint extMain::couplingFlow(Rect& extRect,
                 deallocLimit);
       _search->dealloc(dir, deallocLimit);
 
-      lo_sdb[dir] = hiXY;
+      loXY = hiXY;
       gs_limit = minExtracted - (ccDist + 2) * maxPitch;
 
       stepNum++;
       totalWiresExtracted += processWireCnt;
-      float percent_extracted
-          = lround(100.0 * (1.0 * totalWiresExtracted / totWireCnt));
-
-      if ((totWireCnt > 0) && (totalWiresExtracted > 0)
-          && (percent_extracted - _previous_percent_extracted >= 5.0)) {
-        logger_->info(RCX,
-                      442,
-                      "{:d}% completion -- {:d} wires have been extracted",
-                      (int) (100.0 * (1.0 * totalWiresExtracted / totWireCnt)),
-                      totalWiresExtracted);
-
-        _previous_percent_extracted = percent_extracted;
-      }
+      reportExtractProgress(totalWiresExtracted, totWireCnt);
     }
   }
   if (_printBandInfo)
@@ -1315,6 +1347,258 @@ uint extMain::couplingFlow(Rect& extRect,
   return 0;
 }
 
+void extMain::initCouplingWorker(extMain* main)
+{
+  logger_ = main->logger_;
+  _db = main->_db;
+  _tech = main->_tech;
+  _block = main->_block;
+  _blockId = main->_blockId;
+  _debug_net_id = main->_debug_net_id;
+  _lef_res = main->_lef_res;
+
+  _diagFlow = main->_diagFlow;
+  _couplingFlag = main->_couplingFlag;
+  _ccUp = main->_ccUp;
+  _ccContextDepth = main->_ccContextDepth;
+  _allNet = main->_allNet;
+  _usingMetalPlanes = main->_usingMetalPlanes;
+  _coupleThreshold = main->_coupleThreshold;
+  _CCnoPowerSource = main->_CCnoPowerSource;
+  _CCnoPowerTarget = main->_CCnoPowerTarget;
+
+  _resFactor = main->_resFactor;
+  _resModify = main->_resModify;
+  _ccFactor = main->_ccFactor;
+  _ccModify = main->_ccModify;
+  _gndcFactor = main->_gndcFactor;
+  _gndcModify = main->_gndcModify;
+
+  _processCornerTable = main->_processCornerTable;
+  _scaledCornerTable = main->_scaledCornerTable;
+  _batchScaleExt = main->_batchScaleExt;
+  _cornerCnt = main->_cornerCnt;
+  _currentModel = main->_currentModel;
+  _minModelIndex = main->_minModelIndex;
+  for (uint ii = 0; ii < main->_modelMap.getCnt(); ii++)
+    _modelMap.add(main->_modelMap.get(ii));
+  memcpy(_resistanceTable, main->_resistanceTable, sizeof(_resistanceTable));
+  memcpy(_minDistTable, main->_minDistTable, sizeof(_minDistTable));
+
+  _rotatedGs = main->_rotatedGs;
+
+  if (_ccContextDepth)
+    initContextArray();
+  initDgContextArray();
+}
+
+void extMain::extractBands(Rect& extRect,
+                           extBandGeometry& geom,
+                           int dir,
+                           const std::vector<int>& bands,
+                           int first,
+                           int last,
+                           int margin,
+                           CoupleAndCompute coupleAndCompute,
+                           extBandJournal* journal,
+                           uint& wireCnt)
+{
+  extMain worker;
+  worker.initCouplingWorker(this);
+
+  extMeasure m(logger_);
+  worker.initCouplingMeasure(&m);
+
+  extBandGeometry wgeom;
+  worker.initCouplingSearch(extRect, geom.ccDist, &m, wgeom);
+  if (dir == 0)
+    worker.enableRotatedFlag();
+
+  const uint ccDist = geom.ccDist;
+  const uint maxPitch = geom.maxPitch;
+
+  int** limitArray = new int*[geom.layerCnt];
+  for (uint jj = 0; jj < geom.layerCnt; jj++)
+    limitArray[jj] = new int[10];
+
+  worker._search->initCouplingCapLoops(dir, ccDist, coupleAndCompute, &m);
+
+  // The wires of the bands before "first" that are still on the search grids
+  // when "first" is extracted all start after bands[start - 1].  The bands
+  // before "start" only advance the grids as their wires are not needed.
+  int start = first;
+  while (start > 0 && bands[start - 1] > bands[first - 1] - margin)
+    start--;
+
+  extBandJournal discarded;
+  int gsLimit = geom.ll[dir];
+  for (int band = 0; band < last; band++) {
+    int hiXY = bands[band];
+    int minExtracted;
+    if (band < start) {
+      uint extractedWireCnt = 0;
+      minExtracted
+          = worker._search->couplingCaps(hiXY - ccDist * maxPitch,
+                                         ccDist,
+                                         dir,
+                                         extractedWireCnt,
+                                         coupleAndCompute,
+                                         &m,
+                                         false,
+                                         limitArray);
+    } else {
+      worker._bandJournal = band < first ? &discarded : journal;
+      int loXY = band > 0 ? bands[band - 1] : geom.ll[dir] - geom.step[dir];
+      uint processWireCnt = 0;
+      minExtracted = worker.extractBand(geom,
+                                        dir,
+                                        loXY,
+                                        hiXY,
+                                        gsLimit,
+                                        &m,
+                                        coupleAndCompute,
+                                        limitArray,
+                                        processWireCnt);
+      discarded.clear();
+      if (band >= first)
+        wireCnt += processWireCnt;
+    }
+    worker._search->dealloc(dir, minExtracted - (ccDist + 1) * maxPitch);
+    gsLimit = minExtracted - (ccDist + 2) * maxPitch;
+  }
+
+  for (uint jj = 0; jj < geom.layerCnt; jj++)
+    delete[] limitArray[jj];
+  delete[] limitArray;
+
+  if (worker._geomSeq != NULL)
+    delete worker._geomSeq;
+  delete worker._search;
+  delete worker._modelTable;
+  worker.removeContextArray();
+  worker.removeDgContextArray();
+}
+
+void extMain::couplingFlowThreads(Rect& extRect,
+                                  extBandGeometry& geom,
+                                  uint maxWidth,
+                                  uint totWireCnt,
+                                  CoupleAndCompute coupleAndCompute)
+{
+  const uint ccDist = geom.ccDist;
+
+  // Upper bounds of the bands couplingFlow sweeps in each direction.
+  std::vector<int> bands[2];
+  for (int dir = 1; dir >= 0; dir--) {
+    const int step = geom.step[dir];
+    int hiXY = std::min(geom.ll[dir] + step, geom.ur[dir]);
+    for (; hiXY <= geom.ur[dir]; hiXY += step) {
+      if (geom.ur[dir] - hiXY <= step)
+        hiXY = geom.ur[dir] + 5 * ccDist * geom.maxPitch;
+      bands[dir].push_back(hiXY);
+    }
+  }
+
+  // Wires that started up to this far before a band can still be on the
+  // search grids when it is extracted.
+  uint pitch = geom.maxPitch;
+  for (uint ii = 0; ii < 32; ii++)
+    pitch = std::max(pitch, geom.pitchTable[ii]);
+  const int margin = (3 * ccDist + 4) * pitch + maxWidth;
+
+  // An incremental extraction only needs the bands in reach of the wires of
+  // the marked nets.
+  int firstBand[2];
+  int lastBand[2];
+  for (int dir = 1; dir >= 0; dir--) {
+    const int lo = (dir ? _ccMinY : _ccMinX) - margin;
+    const int hi = (dir ? _ccMaxY : _ccMaxX) + margin;
+    int first = 0;
+    int last = bands[dir].size();
+    if (!_allNet) {
+      while (first < last && bands[dir][first] < lo)
+        first++;
+      while (last > first && last > 1 && bands[dir][last - 2] > hi)
+        last--;
+    }
+    firstBand[dir] = first;
+    lastBand[dir] = last;
+  }
+
+  // Each thread extracts a run of consecutive bands of one direction.
+  struct Chunk
+  {
+    int dir;
+    int first;
+    int last;
+    extBandJournal journal;
+    uint wireCnt;
+  };
+  std::vector<Chunk> chunks;
+  for (int dir = 1; dir >= 0; dir--) {
+    const int bandCnt = lastBand[dir] - firstBand[dir];
+    const int chunkCnt = std::min(bandCnt, _threads);
+    for (int ii = 0; ii < chunkCnt; ii++) {
+      Chunk chunk;
+      chunk.dir = dir;
+      chunk.first = firstBand[dir] + bandCnt * ii / chunkCnt;
+      chunk.last = firstBand[dir] + bandCnt * (ii + 1) / chunkCnt;
+      chunk.wireCnt = 0;
+      chunks.push_back(chunk);
+    }
+  }
+
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(_threads) schedule(dynamic)
+  for (int ii = 0; ii < (int) chunks.size(); ii++) {
+    try {
+      Chunk& chunk = chunks[ii];
+      extractBands(extRect,
+                   geom,
+                   chunk.dir,
+                   bands[chunk.dir],
+                   chunk.first,
+                   chunk.last,
+                   margin,
+                   coupleAndCompute,
+                   &chunk.journal,
+                   chunk.wireCnt);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  // The db is only updated here, in the order of the single threaded flow.
+  uint totalWiresExtracted = 0;
+  for (Chunk& chunk : chunks) {
+    chunk.journal.apply();
+    chunk.journal.clear();
+
+    totalWiresExtracted += chunk.wireCnt;
+    reportExtractProgress(totalWiresExtracted, totWireCnt);
+  }
+
+  enableRotatedFlag();
+}
+
+void extMain::reportExtractProgress(uint totalWiresExtracted, uint totWireCnt)
+{
+  float percent_extracted
+      = lround(100.0 * (1.0 * totalWiresExtracted / totWireCnt));
+
+  if ((totWireCnt > 0) && (totalWiresExtracted > 0)
+      && (percent_extracted - _previous_percent_extracted >= 5.0)) {
+    logger_->info(RCX,
+                  442,
+                  "{:d}% completion -- {:d} wires have been extracted",
+                  (int) (100.0 * (1.0 * totalWiresExtracted / totWireCnt)),
+                  totalWiresExtracted);
+
+    _previous_percent_extracted = percent_extracted;
+  }
+}
+
 dbRSeg* extMain::getRseg(dbNet* net, uint shapeId, Logger* logger)
 {
   int rsegId2 = 0;
@@ -198,6 +198,14 @@ extDistRCTable::extDistRCTable(uint distCnt)
   _measureTable = new Ath__array1D<extDistRC*>(n);
 
   _computeTable = NULL;
+
+  _flatFirstRC = NULL;
+  _flatLastRC = NULL;
+  _flatInfRC = NULL;
+  _flatInfRC2 = NULL;
+  _flatInfRC3 = NULL;
+  _flatFirstDist = 0;
+  _flatLastDist = 0;
 }
 
 extDistRCTable::~extDistRCTable()
@@ -546,8 +554,10 @@ uint extDistRCTable::readRules(Ath__parser* parser,
 
   _measureTable = table;
 
-  if (compute)
+  if (compute) {
     interpolate(4, -1, rcPool);
+    makeFlatTable();
+  }
 
   return cnt;
 }
@@ -580,6 +590,46 @@ void extDistRCTable::makeComputeTable(uint maxDist, uint distUnit)
   n = distUnit * (n / distUnit + 1);
 
   _computeTable = new Ath__array1D<extDistRC*>(n + 1);
+  _computeTable->clear(NULL);
+}
+
+void extDistRCTable::makeFlatTable()
+{
+  _flatTable.clear();
+  _flatFirstRC = NULL;
+  if (_measureTable == NULL || _computeTable == NULL)
+    return;
+
+  uint cnt = _measureTable->getCnt();
+  if (cnt == 0)
+    return;
+
+  _flatFirstRC = _measureTable->get(0);
+  _flatFirstDist = _flatFirstRC->_sep;
+  _flatLastRC = _measureTable->getLast();
+  _flatLastDist = _flatLastRC->_sep;
+  _flatInfRC = NULL;
+  if (_flatLastDist == 100000) {
+    if (cnt < 3) {  // keep the indexed lookup
+      _flatFirstRC = NULL;
+      return;
+    }
+    // same pool neighbours getComputeRC_indexed steps back to
+    _flatInfRC = _flatLastRC - 1;
+    if (_flatInfRC->_sep == 99000)
+      _flatInfRC = _flatInfRC - 1;
+    _flatLastDist = _flatInfRC->_sep;
+    _flatInfRC2 = _measureTable->get(cnt - 2);
+    _flatInfRC3 = _measureTable->get(cnt - 3);
+  }
+
+  uint n = 0;
+  while (n < _computeTable->getSize() && _computeTable->geti(n) != NULL)
+    n++;
+
+  _flatTable.reserve(n);
+  for (uint ii = 0; ii < n; ii++)
+    _flatTable.push_back(*_computeTable->geti(ii));
 }
 
 uint extDistRCTable::addMeasureRC(extDistRC* rc)
@@ -609,6 +659,38 @@ extDistRC* extDistRCTable::getRC_99()
 }
 
 extDistRC* extDistRCTable::getComputeRC(uint dist)
+{
+  if (_flatFirstRC == NULL)
+    return getComputeRC_indexed(dist);
+
+  if (dist <= _flatFirstDist)
+    return _flatFirstRC;
+
+  if (_flatInfRC != NULL) {
+    if (dist >= _flatLastDist) {  // send Inf dist
+      if (dist == _flatLastDist)
+        return _flatInfRC;
+      if (dist <= 2 * _flatLastDist) {
+        static thread_local extDistRC rc31;
+        rc31.interpolate(dist, _flatInfRC3, _flatInfRC2);
+        rc31._coupling = (_flatInfRC->_coupling / dist) * _flatInfRC->_sep;
+        rc31._fringe = _flatInfRC->_fringe;
+        return &rc31;
+      }
+      return _flatLastRC;
+    }
+  } else if (dist >= _flatLastDist - _unit && _flatLastDist > 0) {
+    return _flatLastRC;
+  }
+
+  uint n = dist / _unit;
+  if (n < _flatTable.size())
+    return &_flatTable[n];
+
+  return _computeTable->geti(n);
+}
+
+extDistRC* extDistRCTable::getComputeRC_indexed(uint dist)
 {
   if (_measureTable == NULL)
     return NULL;
@@ -637,17 +719,17 @@ extDistRC* extDistRCTable::getComputeRC(uint dist)
       if (dist <= 2 * lastDist) {  // send Inf dist
 
         uint cnt = _measureTable->getCnt();
-        extDistRC* rc31 = _measureTable->geti(31);
+        static thread_local extDistRC rc31;
         extDistRC* rc2 = _measureTable->get(cnt - 2);
         extDistRC* rc3 = _measureTable->get(cnt - 3);
 
-        rc31->_sep = dist;
-        rc31->interpolate(dist, rc3, rc2);
+        rc31._sep = dist;
+        rc31.interpolate(dist, rc3, rc2);
 
-        rc31->_coupling
+        rc31._coupling
             = (before_lastRC->_coupling / dist) * before_lastRC->_sep;
-        rc31->_fringe = before_lastRC->_fringe;
-        return rc31;
+        rc31._fringe = before_lastRC->_fringe;
+        return &rc31;
       }
       if (dist > lastDist) {  // send Inf dist
         return _measureTable->getLast();
@@ -753,7 +835,6 @@ extDistWidthRCTable::extDistWidthRCTable(bool over,
     _diagDistTable[jj] = NULL;
   }
   _rcDiagDistTable = NULL;
-  _rc31 = rcPool->alloc();
 }
 
 void extDistWidthRCTable::createWidthMap()
@@ -796,8 +877,10 @@ void extDistWidthRCTable::makeWSmapping()
   createWidthMap();
 
   for (uint jj = 0; jj < _metCnt; jj++)
-    for (uint ii = 0; ii < _widthTable->getCnt(); ii++)
+    for (uint ii = 0; ii < _widthTable->getCnt(); ii++) {
       _rcDistTable[jj][ii]->interpolate(4, -1, _rcPoolPtr);
+      _rcDistTable[jj][ii]->makeFlatTable();
+    }
 }
 
 extDistWidthRCTable::extDistWidthRCTable(bool dummy,
@@ -837,7 +920,6 @@ extDistWidthRCTable::extDistWidthRCTable(bool dummy,
     _diagWidthTable[jj] = NULL;
     _diagDistTable[jj] = NULL;
   }
-  _rc31 = NULL;
 }
 
 extDistWidthRCTable::extDistWidthRCTable(bool over,
@@ -914,7 +996,6 @@ extDistWidthRCTable::extDistWidthRCTable(bool over,
     _diagDistTable[jj] = NULL;
   }
   _rcDiagDistTable = NULL;
-  _rc31 = rcPool->alloc();
 }
 
 extDistWidthRCTable::extDistWidthRCTable(bool over,
@@ -992,8 +1073,6 @@ extDistWidthRCTable::extDistWidthRCTable(bool over,
   }
   _rcPoolPtr = rcPool;
   _rcDistTable = NULL;
-
-  _rc31 = rcPool->alloc();
 }
 
 void extDistWidthRCTable::setDiagUnderTables(
@@ -1730,13 +1809,14 @@ extDistRC* extDistWidthRCTable::getRC_99(uint mou, uint w, uint dw, uint ds)
   if ((int) ds == _diagDistTable[mou]->get(dsIndex))
     return rc2;
 
-  _rc31->_sep = ds;
+  static thread_local extDistRC rc31;
+  rc31._sep = ds;
 
   uint lastDist = _lastDiagDist->geti(mou);
   if (ds > lastDist) {  // extrapolate
-    _rc31->_fringe = (rc2->_fringe / ds) * lastDist;
+    rc31._fringe = (rc2->_fringe / ds) * lastDist;
 
-    return _rc31;
+    return &rc31;
   }
   // interpolate;
   uint s1 = _diagDistTable[mou]->get(dsIndex - 1);
@@ -1747,9 +1827,9 @@ extDistRC* extDistWidthRCTable::getRC_99(uint mou, uint w, uint dw, uint ds)
   extDistRC* rc1
       = _rcDiagDistTable[mou][wIndex][dwIndex][dsIndex - 1]->getRC_99();
 
-  _rc31->_fringe = lineSegment(ds, s1, s2, rc1->_fringe, rc2->_fringe);
+  rc31._fringe = lineSegment(ds, s1, s2, rc1->_fringe, rc2->_fringe);
 
-  return _rc31;
+  return &rc31;
 }
 
 double extRCModel::getFringeOver(uint met, uint mUnder, uint w, uint s)
@@ -32,13 +32,18 @@
 
 #include "rcx/extSpef.h"
 
+#include <omp.h>
+#include <zlib.h>
+
 #include <algorithm>
+#include <memory>
 
 #include "dbExtControl.h"
 #include "name.h"
 #include "parse.h"
 #include "rcx/extRCap.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace rcx {
 
@@ -63,6 +68,12 @@ extSpef::extSpef(odb::dbTech* tech,
     _blockId = blk->getId();
 
   _outFP = NULL;
+  _gzFP = NULL;
+  _outBuf = NULL;
+  _outBufSize = 0;
+  _threads = 1;
+  _dnetChunk = nullptr;
+  _nextDNet = 0;
 
   strcpy(_divider, "/");
   strcpy(_delimiter, ":");
@@ -340,6 +351,11 @@ void extSpef::setGzipFlag(bool gzFlag)
   _gzipFlag = gzFlag;
 }
 
+void extSpef::setThreads(int threads)
+{
+  _threads = std::max(threads, 1);
+}
+
 void extSpef::resetTermTables()
 {
   _btermTable->resetCnt(1);
@@ -1394,7 +1410,16 @@ bool extSpef::setOutSpef(char* filename)
 
   strcpy(_outFile, filename);
 
-  if (_gzipFlag) {
+  if (_gzipFlag && _threads > 1) {
+    char gzName[2048];
+    sprintf(gzName, "%s.gz", filename);
+    _gzFP = fopen(gzName, "w");
+    if (_gzFP == NULL) {
+      fprintf(stderr, "Cannot open file %s with permissions \"w\"", gzName);
+      return false;
+    }
+    _outFP = open_memstream(&_outBuf, &_outBufSize);
+  } else if (_gzipFlag) {
     char cmd[2048];
     sprintf(cmd, "gzip -1 > %s.gz", filename);
     _outFP = popen(cmd, "w");
@@ -1413,14 +1438,194 @@ bool extSpef::closeOutFile()
   if (_outFP == NULL)
     return false;
 
-  if (_gzipFlag)
+  if (_gzFP) {
+    flushOutBuffer();
+    fclose(_outFP);
+    free(_outBuf);
+    _outBuf = NULL;
+    fclose(_gzFP);
+    _gzFP = NULL;
+  } else if (_gzipFlag)
     pclose(_outFP);
   else
     fclose(_outFP);
+  _outFP = NULL;
 
   return true;
 }
 
+void extSpef::reportNetsFinished(uint cnt)
+{
+  logger_->info(RCX, 42, "{} nets finished", cnt);
+}
+
+// Compress text into a complete gzip member.  A file of concatenated members
+// is a valid gzip file, so the chunks can be compressed independently.
+std::string extSpef::gzipMember(const char* text, size_t size)
+{
+  z_stream zs;
+  zs.zalloc = Z_NULL;
+  zs.zfree = Z_NULL;
+  zs.opaque = Z_NULL;
+  if (deflateInit2(
+          &zs, 1, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY)
+      != Z_OK) {
+    logger_->error(RCX, 455, "Cannot initialize gzip compression.");
+  }
+  std::string out(deflateBound(&zs, size), '\0');
+  zs.next_in = (Bytef*) text;
+  zs.avail_in = size;
+  zs.next_out = (Bytef*) out.data();
+  zs.avail_out = out.size();
+  deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return out;
+}
+
+// Write what was buffered in memory so far to the gzip file.
+void extSpef::flushOutBuffer()
+{
+  if (_gzFP == NULL)
+    return;
+  fclose(_outFP);
+  if (_outBufSize > 0) {
+    std::string member = gzipMember(_outBuf, _outBufSize);
+    fwrite(member.data(), 1, member.size(), _gzFP);
+  }
+  free(_outBuf);
+  _outBuf = NULL;
+  _outFP = open_memstream(&_outBuf, &_outBufSize);
+}
+
+// Make this a writer of *D_NET sections with the settings of spef.
+void extSpef::initNetWriter(extSpef* spef)
+{
+  _block = spef->_block;
+  _cornerBlock = spef->_cornerBlock;
+  strcpy(_delimiter, spef->_delimiter);
+  _res_unit = spef->_res_unit;
+  _cap_unit = spef->_cap_unit;
+  _cornerCnt = spef->_cornerCnt;
+  _cornersPerBlock = spef->_cornersPerBlock;
+  _noBackSlash = spef->_noBackSlash;
+  _preserveCapValues = spef->_preserveCapValues;
+  _symmetricCCcaps = spef->_symmetricCCcaps;
+  _wConn = spef->_wConn;
+  _wCap = spef->_wCap;
+  _wOnlyCCcap = spef->_wOnlyCCcap;
+  _wRes = spef->_wRes;
+  _noCnum = spef->_noCnum;
+  _foreign = spef->_foreign;
+  _writingNodeCoords = spef->_writingNodeCoords;
+  _singleP = spef->_singleP;
+  _childBlockInstBaseMap = spef->_childBlockInstBaseMap;
+  _childBlockNetBaseMap = spef->_childBlockNetBaseMap;
+  _active_corner_cnt = spef->_active_corner_cnt;
+  for (int ii = 0; ii < _active_corner_cnt; ii++)
+    _active_corner_number[ii] = spef->_active_corner_number[ii];
+  _writeNameMap = spef->_writeNameMap;
+  _termJxy = spef->_termJxy;
+  _gzipFlag = spef->_gzipFlag;
+
+  _nodeCapTable = new Ath__array1D<double*>(16000);
+  initCapTable(_nodeCapTable);
+}
+
+// Format nets[first, last) into memory and return the text, or a gzip
+// member of it.  The instance name map ids depend on the largest net id
+// written before, which the caller passes in as baseNameMap.
+std::string extSpef::writeNetChunk(std::vector<odb::dbNet*>& nets,
+                                   uint first,
+                                   uint last,
+                                   uint baseNameMap)
+{
+  char* buf = NULL;
+  size_t size = 0;
+  _outFP = open_memstream(&buf, &size);
+  _baseNameMap = baseNameMap;
+  for (uint ii = first; ii < last; ii++)
+    writeNet(nets[ii], 0.0, 0);
+  fclose(_outFP);
+  _outFP = NULL;
+
+  std::string text;
+  if (_gzipFlag)
+    text = gzipMember(buf, size);
+  else
+    text.assign(buf, size);
+  free(buf);
+  return text;
+}
+
+// Write the *D_NET sections of nets on _threads threads.  The nets are
+// formatted (and compressed) in chunks by the workers and the chunks are
+// written out in net order, so the file is the same as a serial write.
+// writeNet only modifies the sort index of the cap nodes of its own net.
+uint extSpef::writeNets(std::vector<odb::dbNet*>& nets, uint repChunk)
+{
+  const uint chunkSize = 1000;
+  const uint chunkCnt = (nets.size() + chunkSize - 1) / chunkSize;
+
+  std::vector<uint> baseNameMap(chunkCnt + 1);
+  baseNameMap[0] = _baseNameMap;
+  for (uint ii = 0; ii < chunkCnt; ii++) {
+    uint base = baseNameMap[ii];
+    const uint last = std::min<uint>((ii + 1) * chunkSize, nets.size());
+    for (uint jj = ii * chunkSize; jj < last; jj++)
+      base = std::max(base, nets[jj]->getId());
+    baseNameMap[ii + 1] = base;
+  }
+
+  std::vector<std::unique_ptr<extSpef>> writers;
+  for (int ii = 0; ii < _threads; ii++) {
+    writers.emplace_back(
+        std::make_unique<extSpef>(_tech, _block, logger_, _ext));
+    writers.back()->initNetWriter(this);
+  }
+
+  flushOutBuffer();
+  FILE* fp = _gzFP ? _gzFP : _outFP;
+
+  // Bound the memory held by formatted chunks waiting to be written.
+  const uint roundCnt = 4 * _threads;
+  std::vector<std::string> texts(roundCnt);
+  uint cnt = 0;
+  for (uint first = 0; first < chunkCnt; first += roundCnt) {
+    const uint last = std::min(first + roundCnt, chunkCnt);
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(_threads) schedule(dynamic)
+    for (uint ii = first; ii < last; ii++) {
+      try {
+        extSpef* writer = writers[omp_get_thread_num()].get();
+        texts[ii - first] = writer->writeNetChunk(
+            nets,
+            ii * chunkSize,
+            std::min<uint>((ii + 1) * chunkSize, nets.size()),
+            baseNameMap[ii]);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    for (uint ii = first; ii < last; ii++) {
+      std::string& text = texts[ii - first];
+      fwrite(text.data(), 1, text.size(), fp);
+      text.clear();
+      text.shrink_to_fit();
+
+      const uint prevCnt = cnt;
+      cnt = std::min<uint>((ii + 1) * chunkSize, nets.size());
+      for (uint rep = prevCnt / repChunk + 1; rep <= cnt / repChunk; rep++)
+        reportNetsFinished(rep * repChunk);
+    }
+  }
+  _baseNameMap = baseNameMap[chunkCnt];
+
+  return cnt;
+}
+
 uint extSpef::writeBlockPorts()
 {
   if (_partial && !_btermFound)
@@ -1741,6 +1946,7 @@ uint extSpef::writeBlock(char* nodeCoord,
   odb::dbSet<odb::dbNet>::iterator net_itr;
 
   uint cnt = 0;
+  std::vector<odb::dbNet*> dnets;
 
   for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
     odb::dbNet* net = *net_itr;
@@ -1755,11 +1961,17 @@ uint extSpef::writeBlock(char* nodeCoord,
     if (_wOnlyClock && type != odb::dbSigType::CLOCK)
       continue;
 
+    if (_threads > 1 && _bufString == NULL) {
+      dnets.push_back(net);
+      continue;
+    }
     cnt += writeNet(net, 0.0, 0);
 
     if (cnt % repChunk == 0)
-      logger_->info(RCX, 42, "{} nets finished", cnt);
+      reportNetsFinished(cnt);
   }
+  if (!dnets.empty())
+    cnt = writeNets(dnets, repChunk);
   for (j = 0; j < tnets.size(); j++)
     tnets[j]->setMark(false);
   logger_->info(RCX, 443, "{} nets finished", cnt);
@@ -30,10 +30,21 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <fcntl.h>
+#include <omp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "name.h"
 #include "rcx/extRCap.h"
 #include "rcx/extSpef.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 #include "wire.h"
 
 namespace rcx {
@@ -447,8 +458,60 @@ void extSpef::checkCCterm()
 
 uint extSpef::getCapNodeId(char* nodeWord, char* capWord, uint* netId)
 {
-  dbCapNode* cap = NULL;
-  uint capId = 0;
+  SpefNode node;
+  node.word = nodeWord;
+  node.tokenCnt = _nodeParser->mkWords(nodeWord);
+  node.name = _nodeParser->get(0);
+  node.pin = _nodeParser->get(1);
+
+  uint capId;
+  dbNet* cornerNet;
+  dbCapNode* cap;
+  if (!getCapNode(node, netId, capId, cornerNet, cap))
+    return 0;
+  if (_testParsing)
+    return capId;
+
+  double capVal;
+  if (capWord != NULL && _inputNet && _rCap) {
+    uint capCnt = _nodeParser->mkWords(capWord);
+    if (_diff) {
+      diffGndCap(cornerNet, capCnt, capId);
+    } else {
+      if (_readAllCorners) {
+        for (uint ii = 0; ii < capCnt; ii++) {
+          capVal = _cap_unit * _nodeParser->getDouble(ii);
+          if (_addRepeatedCapValue)
+            cap->addCapacitance(capVal, ii);
+          else
+            cap->setCapacitance(capVal, ii);
+        }
+      } else {
+        capVal = _cap_unit * _nodeParser->getDouble(_in_spef_corner);
+        if (_addRepeatedCapValue)
+          cap->addCapacitance(capVal, _db_ext_corner);
+        else
+          cap->setCapacitance(capVal, _db_ext_corner);
+      }
+    }
+  }
+
+  if (_calib && capId == 0)
+    capId = 1;  //  such that readDNet won't return 0 and call endNet
+  return capId;
+}
+
+// Find or create the cap node of a node word, false if its iterm is not in
+// the db.
+bool extSpef::getCapNode(const SpefNode& node,
+                         uint* netId,
+                         uint& capId,
+                         dbNet*& cornerNet,
+                         dbCapNode*& cap)
+{
+  char* nodeWord = node.word;
+  cap = NULL;
+  capId = 0;
   uint cccap = *netId;
   if (cccap == 1) {
     _cciterm1 = NULL;
@@ -464,22 +527,20 @@ uint extSpef::getCapNodeId(char* nodeWord, char* capWord, uint* netId)
       addNewCapIdOnCapTable(nodeWord, capId);
     }
   }
-  uint tokenCnt = _nodeParser->mkWords(nodeWord);
-
   dbNet* net = NULL;
-  dbNet* cornerNet = NULL;
-  if (tokenCnt == 2)  // iterm or internal node
+  cornerNet = NULL;
+  if (node.tokenCnt == 2)  // iterm or internal node
   {
     uint id1;
     if (_maxMapId) {
-      id1 = _nodeParser->getInt(0, 1);
+      id1 = atoi(node.name + 1);
       _spefName = _nameMapTable->geti(id1);
     } else {
       id1 = 0;
-      _spefName = _nodeParser->get(0);
+      _spefName = node.name;
     }
 
-    if (_nodeParser->isDigit(1, 0))  // internal node
+    if (node.pin[0] >= '0' && node.pin[0] <= '9')  // internal node
     {
       net = getDbNet(netId, id1);
       if (_cornerBlock != _block)
@@ -487,7 +548,7 @@ uint extSpef::getCapNodeId(char* nodeWord, char* capWord, uint* netId)
       else
         cornerNet = net;
 
-      uint nodeId = _nodeParser->getInt(1, 0);
+      uint nodeId = atoi(node.pin);
 
       if (!_testParsing && !_diff) {
         capId = getCapIdFromCapTable(nodeWord);
@@ -504,10 +565,9 @@ uint extSpef::getCapNodeId(char* nodeWord, char* capWord, uint* netId)
       }
     } else  // iterm
     {
-      char* termName = _nodeParser->get(1);
-      uint termId = getITermId(id1, termName);
+      uint termId = getITermId(id1, node.pin);
       if (!termId)
-        return 0;
+        return false;
 
       dbITerm* iterm = NULL;
       if (_block != NULL) {
@@ -557,11 +617,11 @@ uint extSpef::getCapNodeId(char* nodeWord, char* capWord, uint* netId)
   } else  // Port
   {
     uint btermId = 0;
-    if (_nodeParser->get(0)[0] == '*') {  // mapped port
-      uint id = _nodeParser->getInt(0, 1);
+    if (node.name[0] == '*') {  // mapped port
+      uint id = atoi(node.name + 1);
       btermId = getMappedBTermId(id);
     } else {
-      btermId = getBTermId(_nodeParser->get(0));
+      btermId = getBTermId(node.name);
     }
     if (!_testParsing) {
       dbBTerm* bterm = dbBTerm::getBTerm(_block, btermId);
@@ -607,37 +667,7 @@ uint extSpef::getCapNodeId(char* nodeWord, char* capWord, uint* netId)
   }
   if (cccap == 2)
     checkCCterm();
-  ;
-  if (_testParsing)
-    return capId;
-
-  double capVal;
-  if (capWord != NULL && _inputNet && _rCap) {
-    uint capCnt = _nodeParser->mkWords(capWord);
-    if (_diff) {
-      diffGndCap(cornerNet, capCnt, capId);
-    } else {
-      if (_readAllCorners) {
-        for (uint ii = 0; ii < capCnt; ii++) {
-          capVal = _cap_unit * _nodeParser->getDouble(ii);
-          if (_addRepeatedCapValue)
-            cap->addCapacitance(capVal, ii);
-          else
-            cap->setCapacitance(capVal, ii);
-        }
-      } else {
-        capVal = _cap_unit * _nodeParser->getDouble(_in_spef_corner);
-        if (_addRepeatedCapValue)
-          cap->addCapacitance(capVal, _db_ext_corner);
-        else
-          cap->setCapacitance(capVal, _db_ext_corner);
-      }
-    }
-  }
-
-  if (_calib && capId == 0)
-    capId = 1;  //  such that readDNet won't return 0 and call endNet
-  return capId;
+  return true;
 }
 
 // TO DELETE
@@ -1800,6 +1830,9 @@ uint extSpef::readDNet(uint debug)
     if (_parser->parseNextLine() <= 0)
       return 0;
   }
+  StagedDNet* dnet = findStagedDNet();
+  if (dnet)
+    return addDNet(*dnet);
   if (_capNodeFile)
     _parser->printWords(_capNodeFile);
   if (_maxMapId) {
@@ -2066,6 +2099,198 @@ uint extSpef::readDNet(uint debug)
   return 0;  // should not get here!!!
 }
 
+// The staged section of the *D_NET line _parser is on.
+extSpef::StagedDNet* extSpef::findStagedDNet()
+{
+  if (_dnetChunk == nullptr)
+    return nullptr;
+  std::vector<StagedDNet>& dnets = _dnetChunk->dnets;
+  // The words point into the file, so they are in file order.
+  while (_nextDNet < dnets.size() && dnets[_nextDNet].dnet < _parser->get(0))
+    _nextDNet++;
+  if (_nextDNet == dnets.size() || dnets[_nextDNet].dnet != _parser->get(0))
+    return nullptr;
+  return &dnets[_nextDNet++];
+}
+
+void extSpef::setCapValues(dbCapNode* cap, const SpefValues& values)
+{
+  const double* value = &_dnetChunk->values[values.first];
+  if (_readAllCorners) {
+    for (uint ii = 0; ii < values.cnt; ii++) {
+      if (_addRepeatedCapValue)
+        cap->addCapacitance(_cap_unit * value[ii], ii);
+      else
+        cap->setCapacitance(_cap_unit * value[ii], ii);
+    }
+  } else {
+    const double capVal = _cap_unit * value[_in_spef_corner];
+    if (_addRepeatedCapValue)
+      cap->addCapacitance(capVal, _db_ext_corner);
+    else
+      cap->setCapacitance(capVal, _db_ext_corner);
+  }
+}
+
+// Make the db objects of a staged *D_NET section as readDNet does from its
+// words, and leave _parser on the line readDNet would stop at.
+uint extSpef::addDNet(const StagedDNet& dnet)
+{
+  uint resCnt = 0;
+  uint netId = 0;
+  uint capId;
+  dbNet* cornerNet;
+  dbCapNode* cap;
+  auto skipLines = [this](int lineCnt) {
+    for (int ii = 0; ii < lineCnt; ii++)
+      _parser->parseNextLine();
+  };
+
+  if (_maxMapId) {
+    _tmpNetSpefId = atoi(dnet.name + 1);
+    _spefName = _nameMapTable->geti(_tmpNetSpefId);
+  } else {
+    _tmpNetSpefId = 0;
+    _spefName = dnet.name;
+  }
+
+  _d_net = getDbNet(&netId, _tmpNetSpefId);
+  if (!_d_net)
+    return 0;
+  if (_cornerBlock == _block)
+    _d_corner_net = _d_net;
+  else
+    _d_corner_net = dbNet::getNet(_cornerBlock, _d_net->getId());
+  _tmpNetName = _nameMapTable->geti(_tmpNetSpefId);
+
+  _inputNet = (_tnetCnt == 0 || _d_net->isMarked()) ? true : false;
+
+  dbRSeg* zrseg = _d_corner_net->getZeroRSeg();
+  if (zrseg) {
+    logger_->warn(RCX,
+                  280,
+                  "Net {} {} has rseg before reading spef",
+                  _d_net->getId(),
+                  _d_net->getConstName());
+    return 0;
+  }
+  zrseg = dbRSeg::create(_d_corner_net,
+                         0 /*x*/,
+                         0 /*y*/,
+                         0,
+                         false);  // create zrseg, "foreign" mode
+
+  for (const StagedCap& capLine : dnet.caps) {
+    if (capLine.node2.word == nullptr) {  // Grounding cap
+      if (!_rCap)
+        continue;
+      _gndCapCnt++;
+      netId = 0;
+      if (getCapNode(capLine.node1, &netId, capId, cornerNet, cap) && _inputNet)
+        setCapValues(cap, capLine.values);
+      continue;
+    }
+    // Coupling cap
+    _ccCapCnt++;
+    netId = 1;
+    if (!getCapNode(capLine.node1, &netId, capId, cornerNet, cap) || !capId)
+      continue;
+    const uint srcId = capId;
+    netId = 2;
+    if (!getCapNode(capLine.node2, &netId, capId, cornerNet, cap) || !capId)
+      continue;
+    const uint dstId = capId;
+    if (!_inputNet || (!_rCap && !_rOnlyCCcap))
+      continue;
+
+    const double* value = &_dnetChunk->values[capLine.values.first];
+    dbCapNode* srcCapNode = dbCapNode::getCapNode(_cornerBlock, srcId);
+    dbCapNode* tgtCapNode = dbCapNode::getCapNode(_cornerBlock, dstId);
+    if (srcId == dstId) {
+      logger_->warn(RCX,
+                    282,
+                    "Source capnode {} is the same as target capnode {}. Add "
+                    "the cc capacitance to ground.",
+                    capLine.node1.word,
+                    capLine.node2.word);
+      if (_readAllCorners) {
+        for (uint ii = 0; ii < capLine.values.cnt; ii++)
+          srcCapNode->addCapacitance(_cap_unit * value[ii], ii);
+      } else {
+        srcCapNode->addCapacitance(_cap_unit * value[_in_spef_corner],
+                                   _db_ext_corner);
+      }
+      continue;
+    }
+    dbCCSeg* ccseg = dbCCSeg::create(srcCapNode, tgtCapNode, true);
+    if (_readAllCorners) {
+      for (uint ii = 0; ii < capLine.values.cnt; ii++)
+        ccseg->setCapacitance(_cap_unit * value[ii], ii);
+    } else {
+      ccseg->setCapacitance(_cap_unit * value[_in_spef_corner],
+                            _db_ext_corner);
+    }
+  }
+  if (dnet.capEnd) {
+    skipLines(dnet.endLine);
+    return endNet(_d_corner_net, resCnt);
+  }
+  if (_rRun == 1 && !_extracted)
+    _d_corner_net->getCapNodes().reverse();
+  if (_rRun == 1)
+    _d_corner_net->reverseCCSegs();
+
+  _d_corner_net->setSpef(true);
+  bool fstRSegDone = false;
+  for (const StagedRes& res : dnet.res) {
+    _resCnt++;
+    if (_rRes && _inputNet) {
+      netId = 0;
+      if (!getCapNode(res.node1, &netId, capId, cornerNet, cap) || !capId) {
+        skipLines(res.line);
+        return 0;
+      }
+      const uint srcCapNodeId = capId;
+      netId = 0;
+      if (!getCapNode(res.node2, &netId, capId, cornerNet, cap) || !capId) {
+        skipLines(res.line);
+        return 0;
+      }
+      const uint dstCapNodeId = capId;
+
+      if (fstRSegDone == false) {
+        fstRSegDone = true;
+        zrseg->setTargetNode(srcCapNodeId);
+        int ttx, tty;
+        dbCapNode::getCapNode(_cornerBlock, srcCapNodeId)
+            ->getTermCoords(ttx, tty);
+        zrseg->setCoords(ttx, tty);
+      }
+      dbRSeg* rseg = dbRSeg::create(_d_corner_net,
+                                    0 /*x*/,
+                                    0 /*y*/,
+                                    0,
+                                    false);  //"foreign" mode
+
+      const double* value = &_dnetChunk->values[res.values.first];
+      if (_readAllCorners) {
+        for (uint ii = 0; ii < res.values.cnt; ii++)
+          rseg->setResistance(_res_unit * value[ii], ii);
+      } else {
+        rseg->setResistance(_res_unit * value[_in_spef_corner],
+                            _db_ext_corner);
+      }
+
+      rseg->setSourceNode(srcCapNodeId);
+      rseg->setTargetNode(dstCapNodeId);
+    }
+
+    resCnt++;
+  }
+  skipLines(dnet.endLine);
+  return endNet(_d_corner_net, resCnt);
+}
+
 void extSpef::setupMapping(uint itermCnt)
 {
   if (_btermTable)
@@ -2232,6 +2457,453 @@ uint extSpef::readBlockIncr(uint debug)
   return cnt;
 }
 
+void extSpef::readDNets(uint debug, uint& cnt, bool& doSortingRSeg)
+{
+  do {
+    cnt++;
+    readDNet(debug);
+
+    if (cnt % 100000 == 0) {
+      logger_->info(
+          RCX,
+          445,
+          "Have read {} D_NET nets, {} resistors, {} gnd caps {} coupling "
+          "caps",
+          cnt,
+          _resCnt,
+          _gndCapCnt,
+          _ccCapCnt);
+    }
+    bool sortingRSeg = _d_net && !_keep_loaded_corner
+                       && (_doSortRSeg || _readingNodeCoords != C_NONE);
+    doSortingRSeg |= sortingRSeg;
+    if (sortingRSeg) {
+      sortRSegs();
+      dbSet<dbCapNode> nodeSet = _d_corner_net->getCapNodes();
+      dbSet<dbCapNode>::iterator rc_itr;
+      for (rc_itr = nodeSet.begin(); rc_itr != nodeSet.end(); ++rc_itr) {
+        dbCapNode* node = *rc_itr;
+        node->setSortIndex(0);
+      }
+    }
+  } while (_parser->parseNextLine() > 0);
+}
+
+// Start of the next *D_NET line after p.
+static char* findDNetLine(char* p, char* end)
+{
+  while ((p = (char*) memchr(p, '\n', end - p)) != nullptr) {
+    p++;
+    if (end - p > 6 && strncmp(p, "*D_NET", 6) == 0
+        && (p[6] == ' ' || p[6] == '\t'))
+      return p;
+  }
+  return end;
+}
+
+// Split the lines of the chunk into words like Ath__parser does: the words
+// are separated by blanks and a '#' ends the line.  The words are
+// terminated in place, so they point into the mapped file.
+void extSpef::splitDNetChunk(DNetChunk& chunk)
+{
+  int lineNum = 0;
+  char* p = chunk.begin;
+  while (p < chunk.end) {
+    char* eol = (char*) memchr(p, '\n', chunk.end - p);
+    if (eol == nullptr)
+      eol = chunk.end;
+    lineNum++;
+    const int first = chunk.words.size();
+    while (p < eol) {
+      if (*p == ' ' || *p == '\t') {
+        p++;
+        continue;
+      }
+      char* word = p;
+      while (p < eol && *p != ' ' && *p != '\t' && *p != '#')
+        p++;
+      if (p < eol && *p == '#')
+        break;
+      *p++ = '\0';
+      chunk.words.push_back(word);
+    }
+    if ((int) chunk.words.size() > first) {
+      chunk.lineStarts.push_back(first);
+      chunk.lineNums.push_back(lineNum);
+    }
+    p = eol + 1;
+  }
+  chunk.lineStarts.push_back(chunk.words.size());
+  chunk.lineCnt = lineNum;
+}
+
+// Split a word at the separators like Ath__parser::mkWords does.  Returns
+// the number of tokens, the first two are copied to text.
+static int splitWord(const char* word,
+                     const char* separators,
+                     std::vector<char>& text,
+                     size_t tokens[2])
+{
+  int cnt = 0;
+  const char* p = word;
+  while (*p != '\0') {
+    if (strchr(separators, *p) != nullptr) {
+      p++;
+      continue;
+    }
+    const size_t len = strcspn(p, separators);
+    if (cnt < 2) {
+      tokens[cnt] = text.size();
+      text.insert(text.end(), p, p + len);
+      text.push_back('\0');
+    }
+    cnt++;
+    p += len;
+  }
+  return cnt;
+}
+
+bool extSpef::stageNode(DNetChunk& chunk,
+                        char* word,
+                        const char* separators,
+                        SpefNode& node)
+{
+  size_t tokens[2];
+  node.word = word;
+  node.tokenCnt = splitWord(word, separators, chunk.text, tokens);
+  if (node.tokenCnt == 0)
+    return false;
+  // The text is reserved for all of the chunk, so it does not move.
+  node.name = chunk.text.data() + tokens[0];
+  node.pin = node.tokenCnt > 1 ? chunk.text.data() + tokens[1] : nullptr;
+  return true;
+}
+
+bool extSpef::stageValues(DNetChunk& chunk,
+                          const char* word,
+                          const char* separators,
+                          uint minValues,
+                          SpefValues& values)
+{
+  values.first = chunk.values.size();
+  values.cnt = 0;
+  char value[128];
+  const char* p = word;
+  while (*p != '\0') {
+    if (strchr(separators, *p) != nullptr) {
+      p++;
+      continue;
+    }
+    const size_t len = strcspn(p, separators);
+    if (len >= sizeof(value))
+      return false;
+    memcpy(value, p, len);
+    value[len] = '\0';
+    chunk.values.push_back(atof(value));
+    values.cnt++;
+    p += len;
+  }
+  return values.cnt >= minValues;
+}
+
+// Stage the *D_NET section at the line, false if it does not have the plain
+// layout readDNet reads: an optional *CONN section, an optional *CAP
+// section and the *RES section, then *END.
+bool extSpef::stageDNet(DNetChunk& chunk,
+                        int line,
+                        const char* separators,
+                        uint minValues,
+                        StagedDNet& dnet)
+{
+  const int lineCnt = chunk.lineStarts.size() - 1;
+  auto wordCnt = [&](int ii) {
+    return chunk.lineStarts[ii + 1] - chunk.lineStarts[ii];
+  };
+  auto words = [&](int ii) { return &chunk.words[chunk.lineStarts[ii]]; };
+  auto isKeyword = [&](int ii, const char* keyword) {
+    return strcmp(words(ii)[0], keyword) == 0;
+  };
+
+  if (wordCnt(line) < 2)
+    return false;
+  dnet.dnet = words(line)[0];
+  dnet.name = words(line)[1];
+  dnet.capEnd = false;
+
+  int ii = line + 1;
+  if (ii < lineCnt && isKeyword(ii, "*CONN")) {
+    for (ii++; ii < lineCnt; ii++) {
+      if (isKeyword(ii, "*CAP") || isKeyword(ii, "*RES"))
+        break;
+      if (isKeyword(ii, "*END") || isKeyword(ii, "*D_NET"))
+        return false;
+    }
+  }
+  if (ii < lineCnt && isKeyword(ii, "*CAP")) {
+    for (ii++; ii < lineCnt; ii++) {
+      if (isKeyword(ii, "*RES"))
+        break;
+      if (isKeyword(ii, "*END")) {
+        dnet.capEnd = true;
+        break;
+      }
+      if (isKeyword(ii, "*D_NET") || wordCnt(ii) < 3)
+        return false;
+      if (wordCnt(ii) > 4)
+        continue;
+      char** capWords = words(ii);
+      StagedCap cap;
+      cap.node2.word = nullptr;
+      if (!stageNode(chunk, capWords[1], separators, cap.node1))
+        return false;
+      if (wordCnt(ii) == 4
+          && !stageNode(chunk, capWords[2], separators, cap.node2))
+        return false;
+      if (!stageValues(chunk,
+                       capWords[wordCnt(ii) - 1],
+                       separators,
+                       minValues,
+                       cap.values))
+        return false;
+      dnet.caps.push_back(cap);
+    }
+  }
+  if (!dnet.capEnd) {
+    if (ii == lineCnt || !isKeyword(ii, "*RES"))
+      return false;
+    for (ii++; ii < lineCnt; ii++) {
+      if (isKeyword(ii, "*END"))
+        break;
+      if (isKeyword(ii, "*D_NET") || wordCnt(ii) < 4)
+        return false;
+      char** resWords = words(ii);
+      StagedRes res;
+      res.line = ii - line;
+      if (!stageNode(chunk, resWords[1], separators, res.node1)
+          || !stageNode(chunk, resWords[2], separators, res.node2)
+          || !stageValues(
+              chunk, resWords[3], separators, minValues, res.values))
+        return false;
+      dnet.res.push_back(res);
+    }
+  }
+  if (ii == lineCnt)
+    return false;
+  dnet.endLine = ii - line;
+  return true;
+}
+
+// Parse the *D_NET sections of a split chunk into nodes and values, which
+// addDNet turns into db objects without splitting words again.  Each value
+// list needs at least minValues values.
+void extSpef::stageDNets(DNetChunk& chunk,
+                         const char* separators,
+                         uint minValues)
+{
+  // A node copies at most its word and two terminators, the chunk has a
+  // byte after each word but the last.
+  chunk.text.reserve(chunk.end - chunk.begin + chunk.words.size() + 1);
+  const int lineCnt = chunk.lineStarts.size() - 1;
+  for (int ii = 0; ii < lineCnt; ii++) {
+    if (strcmp(chunk.words[chunk.lineStarts[ii]], "*D_NET") != 0)
+      continue;
+    const size_t textSize = chunk.text.size();
+    const size_t valueCnt = chunk.values.size();
+    chunk.dnets.emplace_back();
+    if (!stageDNet(chunk, ii, separators, minValues, chunk.dnets.back())) {
+      chunk.dnets.pop_back();
+      chunk.text.resize(textSize);
+      chunk.values.resize(valueCnt);
+    }
+  }
+}
+
+// Read the *D_NET sections from the memory mapped input file.  The file is
+// cut into chunks of whole nets that the other threads split into words and
+// stage ahead of this one, which makes the db objects in file order.  The
+// staged sections are added by addDNet, the others are read by readDNet
+// through _parser as readDNets does for the file.  Returns false if the file
+// is not read this way.
+bool extSpef::readMappedDNets(uint debug, uint& cnt, bool& doSortingRSeg)
+{
+  const size_t len = strlen(_inFile);
+  if (_threads < 2 || (len > 3 && strcmp(_inFile + len - 3, ".gz") == 0))
+    return false;
+
+  const int fd = open(_inFile, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  const size_t size = st.st_size;
+  // One byte more than the file so the last word can be terminated.
+  char* map = (char*) mmap(nullptr,
+                           size + 1,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1,
+                           0);
+  if (map != MAP_FAILED
+      && mmap(map,
+              size,
+              PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_FIXED,
+              fd,
+              0)
+             == MAP_FAILED) {
+    munmap(map, size + 1);
+    map = (char*) MAP_FAILED;
+  }
+  close(fd);
+  if (map == MAP_FAILED)
+    return false;
+  char* end = map + size;
+
+  // _parser is on the first *D_NET line.
+  char* begin = map;
+  for (int ii = 1; begin != nullptr && ii < _parser->getLineNum(); ii++) {
+    begin = (char*) memchr(begin, '\n', end - begin);
+    if (begin != nullptr)
+      begin++;
+  }
+  if (begin == nullptr
+      || strncmp(begin + strspn(begin, " \t"), "*D_NET", 6) != 0) {
+    munmap(map, size + 1);
+    return false;
+  }
+
+  const size_t chunkSize = 1 << 20;
+  std::vector<DNetChunk> chunks;
+  for (char* p = begin; p < end;) {
+    char* next = (size_t) (end - p) > chunkSize
+                     ? findDNetLine(p + chunkSize, end)
+                     : end;
+    chunks.emplace_back();
+    chunks.back().begin = p;
+    chunks.back().end = next;
+    p = next;
+  }
+  const uint chunkCnt = chunks.size();
+
+  // Only the plain read of the values into the db is staged.
+  const bool stage = !_capNodeFile && !_diff && !_match && !_testParsing
+                     && !_statsOnly && !_keep_loaded_corner
+                     && _readingNodeCoords == C_NONE;
+  const std::string separators = _delimiter;
+  const uint minValues = _readAllCorners ? 0 : _in_spef_corner + 1;
+
+  // Bound the memory of the chunks split ahead of the reader.
+  const uint window = 4 * _threads;
+  const size_t pageSize = sysconf(_SC_PAGESIZE);
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::vector<char> split(chunkCnt, false);
+  uint readCnt = 0;
+  bool stop = false;
+  bool workers = true;
+  std::atomic<uint> nextSplit(0);
+
+  uint current = 0;
+  int lineBase = _parser->getLineNum() - 1;
+  auto useChunk = [&](uint ii) {
+    DNetChunk& chunk = chunks[ii];
+    if (workers) {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [&] { return split[ii] || stop; });
+      if (stop)
+        return false;
+    } else {
+      splitDNetChunk(chunk);
+    }
+    for (int& lineNum : chunk.lineNums)
+      lineNum += lineBase;
+    lineBase += chunk.lineCnt;
+    _dnetChunk = &chunk;
+    _nextDNet = 0;
+    _parser->setInputWords(chunk.words.data(),
+                           chunk.lineStarts.data(),
+                           chunk.lineNums.data(),
+                           chunk.lineStarts.size() - 1);
+    return true;
+  };
+  auto releaseChunk = [&](uint ii) {
+    DNetChunk& chunk = chunks[ii];
+    std::vector<char*>().swap(chunk.words);
+    std::vector<int>().swap(chunk.lineStarts);
+    std::vector<int>().swap(chunk.lineNums);
+    std::vector<StagedDNet>().swap(chunk.dnets);
+    std::vector<char>().swap(chunk.text);
+    std::vector<double>().swap(chunk.values);
+    // The pages were copied when the words were terminated.
+    const size_t first = (chunk.begin - map + pageSize - 1) / pageSize;
+    const size_t last = (chunk.end - map) / pageSize;
+    if (first < last)
+      madvise(map + first * pageSize, (last - first) * pageSize, MADV_DONTNEED);
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      readCnt = ii + 1;
+    }
+    changed.notify_all();
+  };
+  _parser->setNextInput([&] {
+    releaseChunk(current);
+    return ++current < chunkCnt && useChunk(current);
+  });
+
+  utl::ThreadException exception;
+#pragma omp parallel num_threads(_threads)
+  {
+    if (omp_get_thread_num() == 0) {
+      workers = omp_get_num_threads() > 1;
+      try {
+        if (useChunk(0)) {
+          _parser->parseNextLine();
+          readDNets(debug, cnt, doSortingRSeg);
+        }
+      } catch (...) {
+        exception.capture();
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        stop = true;
+      }
+      changed.notify_all();
+    } else {
+      for (uint ii = nextSplit++; ii < chunkCnt; ii = nextSplit++) {
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          changed.wait(lock, [&] { return ii < readCnt + window || stop; });
+          if (stop)
+            break;
+        }
+        try {
+          splitDNetChunk(chunks[ii]);
+          if (stage)
+            stageDNets(chunks[ii], separators.c_str(), minValues);
+        } catch (...) {
+          exception.capture();
+        }
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          split[ii] = true;
+          stop |= exception.hasException();
+        }
+        changed.notify_all();
+      }
+    }
+  }
+  _parser->setNextInput(nullptr);
+  _parser->setInputWords(nullptr, nullptr, nullptr, 0);
+  _dnetChunk = nullptr;
+  munmap(map, size + 1);
+  exception.rethrow();
+
+  return true;
+}
+
 uint extSpef::readBlock(uint debug,
                         std::vector<dbNet*> tnets,
                         bool force,
@@ -2489,34 +3161,8 @@ uint extSpef::readBlock(uint debug,
     _multipleLoop = 0;
     _breakLoopNet = 0;
     bool doSortingRSeg = false;
-    do {
-      cnt++;
-      readDNet(debug);
-
-      if (cnt % 100000 == 0) {
-        logger_->info(
-            RCX,
-            445,
-            "Have read {} D_NET nets, {} resistors, {} gnd caps {} coupling "
-            "caps",
-            cnt,
-            _resCnt,
-            _gndCapCnt,
-            _ccCapCnt);
-      }
-      bool sortingRSeg = _d_net && !_keep_loaded_corner
-                         && (_doSortRSeg || _readingNodeCoords != C_NONE);
-      doSortingRSeg |= sortingRSeg;
-      if (sortingRSeg) {
-        sortRSegs();
-        dbSet<dbCapNode> nodeSet = _d_corner_net->getCapNodes();
-        dbSet<dbCapNode>::iterator rc_itr;
-        for (rc_itr = nodeSet.begin(); rc_itr != nodeSet.end(); ++rc_itr) {
-          dbCapNode* node = *rc_itr;
-          node->setSortIndex(0);
-        }
-      }
-    } while (_parser->parseNextLine() > 0);
+    if (!readMappedDNets(debug, cnt, doSortingRSeg))
+      readDNets(debug, cnt, doSortingRSeg);
     if (doSortingRSeg)
       _cornerBlock->preExttreeMergeRC(0.0, 0);
     if (_stampWire)
@@ -236,6 +236,8 @@ extMain::extMain()
   _noFullIncrSpef = false;
   _adjust_colinear = false;
   _power_source_file = NULL;
+  _threads = 1;
+  _bandJournal = NULL;
 }
 
 void extMain::initDgContextArray()
@@ -294,6 +296,21 @@ void extMain::initContextArray()
     _ccMergedContextArray[ii] = new Ath__array1D<int>(1024);
 }
 
+void extMain::removeContextArray()
+{
+  if (!_ccContextArray)
+    return;
+  uint layerCnt = getExtLayerCnt(_tech);
+  for (uint ii = 1; ii <= layerCnt; ii++) {
+    delete _ccContextArray[ii];
+    delete _ccMergedContextArray[ii];
+  }
+  delete[] _ccContextArray;
+  delete[] _ccMergedContextArray;
+  _ccContextArray = NULL;
+  _ccMergedContextArray = NULL;
+}
+
 uint extMain::getExtLayerCnt(dbTech* tech)
 {
   dbSet<dbTechLayer> layers = tech->getLayers();
@@ -535,6 +552,99 @@ double extMain::getFringe(uint met,
   return rc->getFringe();
 }
 
+void extBandJournal::addCapacitance(dbRSeg* rseg, double cap, int dbIndex)
+{
+  _entries.push_back({CAPACITANCE, dbIndex, rseg, NULL, cap});
+}
+
+void extBandJournal::addResistance(dbRSeg* rseg, double res, int dbIndex)
+{
+  _entries.push_back({RESISTANCE, dbIndex, rseg, NULL, res});
+}
+
+void extBandJournal::addCoupling(dbCapNode* node1,
+                                 dbCapNode* node2,
+                                 double cap,
+                                 int dbIndex)
+{
+  _entries.push_back({COUPLING, dbIndex, node1, node2, cap});
+}
+
+void extBandJournal::apply() const
+{
+  for (const Entry& entry : _entries) {
+    switch (entry.type) {
+      case CAPACITANCE: {
+        dbRSeg* rseg = (dbRSeg*) entry.obj1;
+        double tot = rseg->getCapacitance(entry.dbIndex);
+        tot += entry.value;
+        rseg->setCapacitance(tot, entry.dbIndex);
+        break;
+      }
+      case RESISTANCE: {
+        dbRSeg* rseg = (dbRSeg*) entry.obj1;
+        double tot = rseg->getResistance(entry.dbIndex);
+        tot += entry.value;
+        rseg->setResistance(tot, entry.dbIndex);
+        break;
+      }
+      case COUPLING: {
+        dbCCSeg* ccap = dbCCSeg::create(
+            (dbCapNode*) entry.obj1, (dbCapNode*) entry.obj2, true);
+        ccap->addCapacitance(entry.value, entry.dbIndex);
+        break;
+      }
+    }
+  }
+}
+
+void extMain::addRSegCapacitance(dbRSeg* rseg, double cap, int dbIndex)
+{
+  // An incremental extraction keeps the parasitics of the unmarked nets.
+  if (!_allNet && !rseg->getNet()->isMarked())
+    return;
+  if (_bandJournal != NULL) {
+    _bandJournal->addCapacitance(rseg, cap, dbIndex);
+    return;
+  }
+  double tot = rseg->getCapacitance(dbIndex);
+  tot += cap;
+
+  rseg->setCapacitance(tot, dbIndex);
+}
+
+void extMain::addRSegResistance(dbRSeg* rseg, double res, int dbIndex)
+{
+  if (!_allNet && !rseg->getNet()->isMarked())
+    return;
+  if (_bandJournal != NULL) {
+    _bandJournal->addResistance(rseg, res, dbIndex);
+    return;
+  }
+  double tot = rseg->getResistance(dbIndex);
+  tot += res;
+
+  rseg->setResistance(tot, dbIndex);
+}
+
+void extMain::addCCCapacitance(dbRSeg* rseg1,
+                               dbRSeg* rseg2,
+                               double cap,
+                               int dbIndex)
+{
+  dbCapNode* node1 = dbCapNode::getCapNode(_block, rseg1->getTargetNode());
+  dbCapNode* node2 = dbCapNode::getCapNode(_block, rseg2->getTargetNode());
+  if (!_allNet && !node1->getNet()->isMarked()
+      && !node2->getNet()->isMarked())
+    return;
+  if (_bandJournal != NULL) {
+    _bandJournal->addCoupling(node1, node2, cap, dbIndex);
+    return;
+  }
+  dbCCSeg* ccap = dbCCSeg::create(node1, node2, true);
+  ccap->addCapacitance(cap, dbIndex);
+}
+
 void extMain::updateTotalCap(dbRSeg* rseg,
                              double frCap,
                              double ccCap,
@@ -543,10 +653,7 @@ void extMain::updateTotalCap(dbRSeg* rseg,
 {
   double cap = frCap + ccCap - deltaFr;
 
-  double tot = rseg->getCapacitance(modelIndex);
-  tot += cap;
-
-  rseg->setCapacitance(tot, modelIndex);
+  addRSegCapacitance(rseg, cap, modelIndex);
 }
 
 void extMain::updateTotalRes(dbRSeg* rseg1,
@@ -562,18 +669,10 @@ void extMain::updateTotalRes(dbRSeg* rseg1,
     if (_resModify)
       res *= _resFactor;
 
-    if (rseg1 != NULL) {
-      double tot = rseg1->getResistance(modelIndex);
-      tot += res;
-
-      rseg1->setResistance(tot, modelIndex);
-    }
-    if (rseg2 != NULL) {
-      double tot = rseg2->getResistance(modelIndex);
-      tot += res;
-
-      rseg2->setResistance(tot, modelIndex);
-    }
+    if (rseg1 != NULL)
+      addRSegResistance(rseg1, res, modelIndex);
+    if (rseg2 != NULL)
+      addRSegResistance(rseg2, res, modelIndex);
   }
 }
 
@@ -584,7 +683,7 @@ void extMain::updateTotalCap(dbRSeg* rseg,
                              bool includeCoupling,
                              bool includeDiag)
 {
-  double tot, cap;
+  double cap;
   int extDbIndex, sci, scDbIdx;
   for (uint modelIndex = 0; modelIndex < modelCnt; modelIndex++) {
     extDistRC* rc = m->_rc[modelIndex];
@@ -604,17 +703,13 @@ void extMain::updateTotalCap(dbRSeg* rseg,
       cap *= _gndcFactor;
 
     extDbIndex = getProcessCornerDbIndex(modelIndex);
-    tot = rseg->getCapacitance(extDbIndex);
-    tot += cap;
+    addRSegCapacitance(rseg, cap, extDbIndex);
 
-    rseg->setCapacitance(tot, extDbIndex);
     getScaledCornerDbIndex(modelIndex, sci, scDbIdx);
     if (sci == -1)
       continue;
     getScaledGndC(sci, cap);
-    tot = rseg->getCapacitance(scDbIdx);
-    tot += cap;
-    rseg->setCapacitance(tot, scDbIdx);
+    addRSegCapacitance(rseg, cap, scDbIdx);
   }
 }
 
@@ -271,12 +271,11 @@ extDistRC* extDistRCTable::getComputeRC_res(uint dist1, uint dist2)
     return NULL;
 
   extDistRC* rc1 = _measureTableR[0]->geti(0);
-  rc1->_diag = 0.0;
   if (rc1 == NULL)
     return NULL;
 
   if (dist1 + dist2 == 0) {  // ASSUMPTION: 0 dist exists as first
-    return rc1;
+    return getResCopy(rc1, 0.0);
   }
   if (dist1 >= _maxDist && dist2 >= _maxDist) {
     return NULL;
@@ -290,7 +289,7 @@ extDistRC* extDistRCTable::getComputeRC_res(uint dist1, uint dist2)
   bool found = false;
   extDistRC* rc2 = _measureTableR[1]->geti(0);
   if (rc2 == NULL)
-    return rc1;
+    return getResCopy(rc1, 0.0);
 
   if (dist1 <= rc1->_sep) {
     index_dist = 0;
@@ -328,39 +327,46 @@ extDistRC* extDistRCTable::getComputeRC_res(uint dist1, uint dist2)
     }
   }
   if (found) {
-    _measureTable = _measureTableR[index_dist];
-    _computeTable = _computeTableR[index_dist];
-    extDistRC* res = findIndexed_res(dist1, dist2);
-    res->_diag = 0;
+    extDistRC* res = findIndexed_res(index_dist, dist1, dist2);
     if (rc != NULL && dist1 < rc->_sep) {
-      _measureTable = _measureTableR[index_dist - 1];
-      _computeTable = _computeTableR[index_dist - 1];
-      extDistRC* res1 = findIndexed_res(dist1, dist2);
+      extDistRC* res1 = findIndexed_res(index_dist - 1, dist1, dist2);
       double R1 = res->interpolate_res(dist1, res1);
-      res1->_diag = R1;
-      return res1;
+      return getResCopy(res1, R1);
     }
-    return res;
+    return getResCopy(res, 0.0);
   }
   return NULL;
 }
 
-extDistRC* extDistRCTable::findIndexed_res(uint dist1, uint dist2)
+// The tables are shared by the extraction threads, the diag value the
+// caller reads is returned on a per thread copy instead of the table entry.
+extDistRC* extDistRCTable::getResCopy(extDistRC* rc, double diag)
 {
-  extDistRC* firstRC = _measureTable->get(0);
+  static thread_local extDistRC copy;
+  copy = *rc;
+  copy._diag = diag;
+  return &copy;
+}
+
+extDistRC* extDistRCTable::findIndexed_res(uint index_dist,
+                                           uint dist1,
+                                           uint dist2)
+{
+  Ath__array1D<extDistRC*>* measureTable = _measureTableR[index_dist];
+  extDistRC* firstRC = measureTable->get(0);
   uint firstDist = firstRC->_sep;
   if (dist2 <= firstDist) {
     return firstRC;
   }
-  if (_measureTable->getCnt() == 1) {
+  if (measureTable->getCnt() == 1) {
     return firstRC;
   }
-  extDistRC* resLast = _measureTable->getLast();
+  extDistRC* resLast = measureTable->getLast();
   if (dist2 >= resLast->_sep)
     return resLast;
 
   uint n = dist2 / _unit;
-  extDistRC* res = _computeTable->geti(n);
+  extDistRC* res = _computeTableR[index_dist]->geti(n);
   return res;
 }
 
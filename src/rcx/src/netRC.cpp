@@ -30,6 +30,8 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <limits>
 #include <map>
 #include <vector>
@@ -543,6 +545,9 @@ uint extMain::getCapNodeId(dbNet* net,
     return capId;
   } else {
     int capId = _nodeTable->geti(junction);
+    if (capId == -1 && (int) junction == _capNodeOneJunction) {
+      capId = 1;
+    }
     if (capId != 0 && capId != -1) {
       capId = abs(capId);
       dbCapNode* cap = dbCapNode::getCapNode(_block, capId);
@@ -604,6 +609,11 @@ uint extMain::getCapNodeId(dbNet* net,
 
     uint ncapId = cap->getId();
     int tcapId = capId == 0 ? ncapId : -ncapId;
+    // Incremental extraction reuses freed ids, tell a branch node with id 1
+    // from the -1 of an unvisited branch.
+    if (tcapId == -1) {
+      _capNodeOneJunction = junction;
+    }
     _nodeTable->set(junction, tcapId);
     return ncapId;
   }
@@ -611,6 +621,7 @@ uint extMain::getCapNodeId(dbNet* net,
 
 uint extMain::resetMapNodes(dbNet* net)
 {
+  _capNodeOneJunction = -1;
   dbWire* wire = net->getWire();
   if (wire == NULL) {
     if (_reportNetNoWire)
@@ -1591,7 +1602,7 @@ void extMain::makeCornerNameMap()
   updatePrevControl();
 }
 
-bool extMain::setCorners(const char* rulesFileName)
+bool extMain::setCorners(const char* rulesFileName, bool keepParasitics)
 {
   _modelMap.resetCnt(0);
   uint ii;
@@ -1673,7 +1684,9 @@ bool extMain::setCorners(const char* rulesFileName)
   assert(_cornerCnt == _extDbCnt + scaleCornerCnt);
 #endif
 
-  _block->setCornerCount(_cornerCnt, _extDbCnt, NULL);
+  // Setting the corner count removes all the parasitics.
+  if (!keepParasitics || _block->getCornerCount() != (int) _cornerCnt)
+    _block->setCornerCount(_cornerCnt, _extDbCnt, NULL);
   return true;
 }
 
@@ -1723,6 +1736,274 @@ void extMain::getPrevControl()
   _usingMetalPlanes = _prevControl->_usingMetalPlanes;
 }
 
+void extMain::initCouplingMeasure(extMeasure* m)
+{
+  m->_extMain = this;
+  m->_block = _block;
+  m->_diagFlow = _diagFlow;
+
+  m->_resFactor = _resFactor;
+  m->_resModify = _resModify;
+  m->_ccFactor = _ccFactor;
+  m->_ccModify = _ccModify;
+  m->_gndcFactor = _gndcFactor;
+  m->_gndcModify = _gndcModify;
+
+  m->_dgContextArray = _dgContextArray;
+  m->_dgContextDepth = &_dgContextDepth;
+  m->_dgContextPlanes = &_dgContextPlanes;
+  m->_dgContextTracks = &_dgContextTracks;
+  m->_dgContextBaseLvl = &_dgContextBaseLvl;
+  m->_dgContextLowLvl = &_dgContextLowLvl;
+  m->_dgContextHiLvl = &_dgContextHiLvl;
+  m->_dgContextBaseTrack = _dgContextBaseTrack;
+  m->_dgContextLowTrack = _dgContextLowTrack;
+  m->_dgContextHiTrack = _dgContextHiTrack;
+  m->_dgContextTrackBase = _dgContextTrackBase;
+  m->_dgContextCnt = 0;
+
+  m->_ccContextArray = _ccContextArray;
+
+  m->_pixelTable = _geomSeq;
+  m->_minModelIndex = 0;  // couplimg threshold will be appled to this cap
+  m->_maxModelIndex = 0;
+  m->_currentModel = _currentModel;
+  m->_diagModel = _currentModel[0].getDiagModel();
+  for (uint ii = 0; ii < _modelMap.getCnt(); ii++) {
+    uint jj = _modelMap.get(ii);
+    m->_metRCTable.add(_currentModel->getMetRCTable(jj));
+  }
+  uint techLayerCnt = getExtLayerCnt(_tech) + 1;
+  uint modelLayerCnt = _currentModel->getLayerCnt();
+  m->_layerCnt = techLayerCnt < modelLayerCnt ? techLayerCnt : modelLayerCnt;
+  if (techLayerCnt == 5 && modelLayerCnt == 8)
+    m->_layerCnt = modelLayerCnt;
+  m->getMinWidth(_tech);
+  m->allocOUpool();
+
+  m->_debugFP = NULL;
+  m->_netId = 0;
+}
+
+void extNetTracker::alter(dbNet* net)
+{
+  if (net == NULL || net->getSigType().isSupply() || net->isWireAltered())
+    return;
+  std::vector<dbShape>& shapes = _shapes[net];
+  dbWire* wire = net->getWire();
+  if (wire != NULL) {
+    dbWireShapeItr itr;
+    dbShape s;
+    for (itr.begin(wire); itr.next(s);)
+      shapes.push_back(s);
+  }
+  net->setWireAltered(true);
+}
+
+void extNetTracker::takeShapes(std::vector<dbNet*>& nets,
+                               std::vector<dbShape>& shapes)
+{
+  for (dbNet* net : nets) {
+    auto itr = _shapes.find(net);
+    if (itr == _shapes.end())
+      continue;
+    shapes.insert(shapes.end(), itr->second.begin(), itr->second.end());
+    _shapes.erase(itr);
+  }
+  shapes.insert(shapes.end(), _destroyedShapes.begin(), _destroyedShapes.end());
+  _destroyedShapes.clear();
+}
+
+void extNetTracker::clear()
+{
+  _shapes.clear();
+  _destroyedShapes.clear();
+}
+
+void extNetTracker::inDbNetDestroy(dbNet* net)
+{
+  auto itr = _shapes.find(net);
+  if (itr != _shapes.end()) {
+    _destroyedShapes.insert(
+        _destroyedShapes.end(), itr->second.begin(), itr->second.end());
+    _shapes.erase(itr);
+  }
+
+  // The coupling caps of the net would be left dangling on its neighbors.
+  std::vector<dbNet*> nets(1, net);
+  std::vector<dbNet*> halo;
+  dbBlock* block = net->getBlock();
+  block->getCcHaloNets(nets, halo);
+  block->destroyCCs(nets);
+  for (dbNet* other : halo)
+    alter(other);
+}
+
+void extNetTracker::inDbITermPostConnect(dbITerm* iterm)
+{
+  alter(iterm->getNet());
+}
+
+void extNetTracker::inDbITermPostDisconnect(dbITerm*, dbNet* net)
+{
+  alter(net);
+}
+
+void extNetTracker::inDbBTermPostConnect(dbBTerm* bterm)
+{
+  alter(bterm->getNet());
+}
+
+void extNetTracker::inDbBTermPostDisConnect(dbBTerm*, dbNet* net)
+{
+  alter(net);
+}
+
+void extNetTracker::inDbWireCreate(dbWire* wire)
+{
+  alter(wire->getNet());
+}
+
+void extNetTracker::inDbWireDestroy(dbWire* wire)
+{
+  alter(wire->getNet());
+}
+
+void extNetTracker::inDbWirePreModify(dbWire* wire)
+{
+  alter(wire->getNet());
+}
+
+void extNetTracker::inDbWirePreAttach(dbWire* wire, dbNet* net)
+{
+  alter(wire->getNet());
+  alter(net);
+}
+
+void extNetTracker::inDbWirePreDetach(dbWire* wire)
+{
+  alter(wire->getNet());
+}
+
+void extNetTracker::inDbWirePreAppend(dbWire*, dbWire* dst)
+{
+  alter(dst->getNet());
+}
+
+void extNetTracker::inDbWirePreCopy(dbWire*, dbWire* dst)
+{
+  alter(dst->getNet());
+}
+
+// Adds to neighbors the signal nets with a shape within coupling distance of
+// the wires of nets or of shapes.  The distance is measured in tracks of the
+// widest pitch as the diagonal context reaches the layers above and below.
+void extMain::addCouplingNeighbors(std::vector<dbNet*>& nets,
+                                   std::vector<dbShape>& shapes,
+                                   std::vector<dbNet*>& neighbors)
+{
+  namespace bg = boost::geometry;
+  namespace bgi = boost::geometry::index;
+  typedef bg::model::point<int, 2, bg::cs::cartesian> point;
+  typedef bg::model::box<point> box;
+
+  int pitch = 0;
+  for (dbTechLayer* layer : _tech->getLayers()) {
+    if (layer->getRoutingLevel() > 0)
+      pitch = std::max(pitch, layer->getPitch());
+  }
+  const int reach = (_couplingFlag + 1) * pitch;
+  auto getBox = [](dbShape& s, int bloat) {
+    Rect r;
+    s.getBox().bloat(bloat, r);
+    return box(point(r.xMin(), r.yMin()), point(r.xMax(), r.yMax()));
+  };
+
+  bgi::rtree<box, bgi::quadratic<16>> changed;
+  for (dbShape& s : shapes)
+    changed.insert(getBox(s, reach));
+  for (dbNet* net : nets) {
+    net->setMark(true);
+    dbWire* wire = net->getWire();
+    if (wire == NULL)
+      continue;
+    dbWireShapeItr itr;
+    dbShape s;
+    for (itr.begin(wire); itr.next(s);)
+      changed.insert(getBox(s, reach));
+  }
+  for (dbNet* net : neighbors)
+    net->setMark(true);
+
+  const uint cnt = neighbors.size();
+  if (!changed.empty()) {
+    for (dbNet* net : _block->getNets()) {
+      if (net->isMarked() || net->getSigType().isSupply())
+        continue;
+      dbWire* wire = net->getWire();
+      if (wire == NULL)
+        continue;
+      dbWireShapeItr itr;
+      dbShape s;
+      for (itr.begin(wire); itr.next(s);) {
+        if (changed.qbegin(bgi::intersects(getBox(s, 0))) != changed.qend()) {
+          neighbors.push_back(net);
+          break;
+        }
+      }
+    }
+  }
+
+  for (dbNet* net : nets)
+    net->setMark(false);
+  for (uint ii = 0; ii < cnt; ii++)
+    neighbors[ii]->setMark(false);
+}
+
+// Removes the parasitics of the nets to extract again: the given nets or
+// else the nets with altered wires, and the nets they were or are now
+// coupled to.  Returns false if there are none.
+bool extMain::getIncrementalNets(const char* netNames,
+                                 std::vector<dbNet*>& nets)
+{
+  std::vector<dbNet*> changed;
+  if (netNames != NULL && netNames[0] != '\0') {
+    _block->findSomeNet(netNames, changed);
+  } else {
+    for (dbNet* net : _block->getNets()) {
+      if (net->isWireAltered())
+        changed.push_back(net);
+    }
+  }
+  std::vector<dbNet*> signals;
+  for (dbNet* net : changed) {
+    if (!net->getSigType().isSupply())
+      signals.push_back(net);
+  }
+  if (signals.empty())
+    return false;
+
+  // The nets coupled to the changed nets before the edits are found from
+  // their coupling caps and extracted shapes, the ones after from their wires.
+  std::vector<dbNet*> neighbors;
+  _block->getCcHaloNets(signals, neighbors);
+  std::vector<dbShape> shapes;
+  _netTracker.takeShapes(signals, shapes);
+  addCouplingNeighbors(signals, shapes, neighbors);
+
+  logger_->info(RCX,
+                400,
+                "Incremental extraction of {} changed nets and {} neighbor "
+                "nets",
+                signals.size(),
+                neighbors.size());
+
+  nets = signals;
+  nets.insert(nets.end(), neighbors.begin(), neighbors.end());
+  removeExt(nets);
+  return true;
+}
+
 uint extMain::makeBlockRCsegs(const char* netNames,
                               uint cc_up,
                               uint ccFlag,
@@ -1730,7 +2011,8 @@ uint extMain::makeBlockRCsegs(const char* netNames,
                               bool mergeViaRes,
                               double ccThres,
                               int contextDepth,
-                              const char* extRules)
+                              const char* extRules,
+                              bool incremental)
 {
   uint debugNetId = 0;
 
@@ -1760,7 +2042,7 @@ uint extMain::makeBlockRCsegs(const char* netNames,
       || ((_processCornerTable == NULL) && (extRules != NULL))) {
     const char* rulesfile
         = extRules ? extRules : _prevControl->_ruleFileName.c_str();
-    if (!setCorners(rulesfile)) {
+    if (!setCorners(rulesfile, incremental)) {
       logger_->info(RCX, 128, "skipping Extraction ...");
       return 0;
     }
@@ -1770,7 +2052,32 @@ uint extMain::makeBlockRCsegs(const char* netNames,
   }
   _foreign = false;  // extract after read_spef
 
-  _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  // The edits are tracked from an incremental extraction on, without them
+  // (or -nets) an incremental extraction extracts all nets.
+  const bool trackEdits = incremental;
+  if (incremental) {
+    int numOfNet, numOfRSeg, numOfCapNode, numOfCCSeg;
+    _block->getExtCount(numOfNet, numOfRSeg, numOfCapNode, numOfCCSeg);
+    const bool tracked = _netTracker.hasOwner() || (netNames && netNames[0]);
+    if (numOfRSeg == 0 || !tracked) {
+      logger_->info(RCX,
+                    401,
+                    "No tracked parasitics to update, extracting all nets of "
+                    "{}.",
+                    getBlock()->getName().c_str());
+      incremental = false;
+      netNames = NULL;
+    }
+  }
+  if (incremental) {
+    if (!getIncrementalNets(netNames, inets)) {
+      logger_->info(RCX, 402, "No changed nets to extract.");
+      return 1;
+    }
+    _allNet = false;
+  } else {
+    _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  }
 
   if (_ccContextDepth)
     initContextArray();
@@ -1854,53 +2161,10 @@ uint extMain::makeBlockRCsegs(const char* netNames,
                   _coupleThreshold,
                   _coupleThreshold);
 
-    m._extMain = this;
-    m._block = _block;
-    m._diagFlow = _diagFlow;
-
-    m._resFactor = _resFactor;
-    m._resModify = _resModify;
-    m._ccFactor = _ccFactor;
-    m._ccModify = _ccModify;
-    m._gndcFactor = _gndcFactor;
-    m._gndcModify = _gndcModify;
-
-    m._dgContextArray = _dgContextArray;
-    m._dgContextDepth = &_dgContextDepth;
-    m._dgContextPlanes = &_dgContextPlanes;
-    m._dgContextTracks = &_dgContextTracks;
-    m._dgContextBaseLvl = &_dgContextBaseLvl;
-    m._dgContextLowLvl = &_dgContextLowLvl;
-    m._dgContextHiLvl = &_dgContextHiLvl;
-    m._dgContextBaseTrack = _dgContextBaseTrack;
-    m._dgContextLowTrack = _dgContextLowTrack;
-    m._dgContextHiTrack = _dgContextHiTrack;
-    m._dgContextTrackBase = _dgContextTrackBase;
+    initCouplingMeasure(&m);
     if (ttttPrintDgContext)
       m._dgContextFile = fopen("dgCtxtFile", "w");
-    m._dgContextCnt = 0;
-
-    m._ccContextArray = _ccContextArray;
 
-    m._pixelTable = _geomSeq;
-    m._minModelIndex = 0;  // couplimg threshold will be appled to this cap
-    m._maxModelIndex = 0;
-    m._currentModel = _currentModel;
-    m._diagModel = _currentModel[0].getDiagModel();
-    for (uint ii = 0; ii < _modelMap.getCnt(); ii++) {
-      uint jj = _modelMap.get(ii);
-      m._metRCTable.add(_currentModel->getMetRCTable(jj));
-    }
-    uint techLayerCnt = getExtLayerCnt(_tech) + 1;
-    uint modelLayerCnt = _currentModel->getLayerCnt();
-    m._layerCnt = techLayerCnt < modelLayerCnt ? techLayerCnt : modelLayerCnt;
-    if (techLayerCnt == 5 && modelLayerCnt == 8)
-      m._layerCnt = modelLayerCnt;
-    m.getMinWidth(_tech);
-    m.allocOUpool();
-
-    m._debugFP = NULL;
-    m._netId = 0;
     debugNetId = 0;
     if (debugNetId > 0) {
       m._netId = debugNetId;
@@ -1963,6 +2227,15 @@ uint extMain::makeBlockRCsegs(const char* netNames,
   if (_batchScaleExt)
     genScaledExt();
 
+  if (!trackEdits) {
+    _netTracker.removeOwner();
+    _netTracker.clear();
+  } else {
+    if (_allNet)
+      _netTracker.clear();
+    _netTracker.addOwner(_block);
+  }
+
   return 1;
 }
 
@@ -2144,7 +2417,8 @@ uint extMain::writeSPEF(char* filename,
                         bool noBackSlash,
                         int corner,
                         const char* corner_name,
-                        bool parallel)
+                        bool parallel,
+                        int threads)
 {
   if (_block == NULL) {
     logger_->info(
@@ -2178,6 +2452,7 @@ uint extMain::writeSPEF(char* filename,
 
   if (gzFlag)
     _spef->setGzipFlag(gzFlag);
+  _spef->setThreads(threads);
 
   _spef->setDesign((char*) _block->getName().c_str());
 
@@ -2247,7 +2522,8 @@ uint extMain::readSPEF(char* filename,
                        bool moreToRead,
                        bool diff,
                        bool calib,
-                       int app_print_limit)
+                       int app_print_limit,
+                       int threads)
 {
   if (!_spef || _spef->getBlock() != _block) {
     if (_spef)
@@ -2256,6 +2532,7 @@ uint extMain::readSPEF(char* filename,
   }
   _spef->_moreToRead = moreToRead;
   _spef->incr_rRun();
+  _spef->setThreads(threads);
 
   _spef->setUseIdsFlag(diff, calib);
   if (_extRun == 0)
@@ -0,0 +1,53 @@
+# extract_parasitics -incremental after wire edits matches a full extraction
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def 45_gcd.def
+
+# Load via resistance info
+source 45_via_resistance.tcl
+
+define_process_corner -ext_model_index 0 X
+
+set block [ord::get_db_block]
+set nets [list [$block findNet req_val] [$block findNet _086_]]
+
+# Extract all nets without the wires of two nets, the wire edits are
+# tracked from here on
+set wires {}
+foreach net $nets {
+  set wire [$net getWire]
+  $wire detach
+  lappend wires $wire
+}
+extract_parasitics -ext_model_file 45_patterns.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental
+
+# Route them again, only they and their neighbors are extracted again.
+# The freed cap node ids are reused for them.
+foreach net $nets wire $wires {
+  $wire attach $net
+}
+extract_parasitics -ext_model_file 45_patterns.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental
+
+set spef_file [make_result_file ext_incremental.spef]
+write_spef $spef_file
+diff_files 45_gcd.spefok $spef_file
+
+# Remove the wires of two other nets and extract them by name
+odb::dbWire_destroy [[$block findNet _116_] getWire]
+odb::dbWire_destroy [[$block findNet _146_] getWire]
+extract_parasitics -ext_model_file 45_patterns.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental -nets "_116_ _146_"
+
+set nets_file [make_result_file ext_incremental_nets.spef]
+write_spef $nets_file
+
+extract_parasitics -ext_model_file 45_patterns.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+set full_file [make_result_file ext_incremental_full.spef]
+write_spef $full_file
+diff_files $full_file $nets_file
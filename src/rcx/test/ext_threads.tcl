@@ -0,0 +1,20 @@
+# extract_parasitics on several threads gives the single threaded result
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def 45_gcd.def
+
+# Load via resistance info
+source 45_via_resistance.tcl
+
+set_thread_count 4
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file 45_patterns.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+set spef_file [make_result_file ext_threads.spef]
+write_spef $spef_file
+
+diff_files 45_gcd.spefok $spef_file
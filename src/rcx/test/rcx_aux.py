@@ -17,7 +17,10 @@ def extract_parasitics(*, ext_model_file=None,
                        lef_res=False,
                        cc_model=10,
                        context_depth=5,
-                       no_merge_via_res=False
+                       no_merge_via_res=False,
+                       incremental=False,
+                       nets="",
+                       thread_count=1
                        ):
     # NOTE: This is position dependent
     rcx.extract(ext_model_file,
@@ -28,11 +31,14 @@ def extract_parasitics(*, ext_model_file=None,
                 context_depth,
                 debug_net_id,
                 lef_res,
-                no_merge_via_res)
+                no_merge_via_res,
+                incremental,
+                nets,
+                thread_count)
 
 
-def write_spef(*, filename="", nets="", net_id=0):
-    rcx.write_spef(filename, nets, net_id)
+def write_spef(*, filename="", nets="", net_id=0, gz=False, thread_count=1):
+    rcx.write_spef(filename, nets, net_id, gz, thread_count)
 
 
 def bench_verilog(*, filename=""):
@@ -78,6 +84,6 @@ def write_rules(*,
     rcx.write_rules(filename, dir, name, pattern)
 
 
-def read_spef(*, filename):
-    rcx.read_spef(filename)
+def read_spef(*, filename, thread_count=1):
+    rcx.read_spef(filename, thread_count)
 
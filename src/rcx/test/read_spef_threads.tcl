@@ -0,0 +1,26 @@
+# bench_read_spef on several threads
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+
+read_def gcd.def
+
+# The reader looks the names up as they are, so drop the escapes write_spef
+# puts before . and $.
+set stream [open gcd.spefok r]
+set spef [string map {"\\." "." "\\$" "$"} [read $stream]]
+close $stream
+set in_file [make_result_file read_spef_threads_in.spef]
+set stream [open $in_file w]
+puts -nonewline $stream $spef
+close $stream
+
+set_thread_count 4
+
+# A relative name keeps the result path out of the log.
+bench_read_spef results/[file tail $in_file]
+
+set spef_file [make_result_file read_spef_threads.spef]
+write_spef $spef_file
+diff_files read_spef_threads.spefok $spef_file
@@ -4,7 +4,11 @@ record_tests {
   ext_pattern
   gcd 
   45_gcd
+  ext_threads
+  ext_incremental
   names
+  write_spef_threads
+  read_spef_threads
 }
 record_pass_fail_tests {
   rcx_unit_test
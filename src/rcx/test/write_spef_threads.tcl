@@ -0,0 +1,26 @@
+# write_spef on several threads, also compressed
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+set_thread_count 4
+
+set spef_file [make_result_file write_spef_threads.spef]
+write_spef $spef_file
+diff_files gcd.spefok $spef_file
+
+set gz_file [make_result_file write_spef_threads_gz.spef]
+write_spef -gz $gz_file
+exec gzip -dc $gz_file.gz > $gz_file
+diff_files gcd.spefok $gz_file
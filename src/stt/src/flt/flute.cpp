@@ -33,13 +33,16 @@
 #include "stt/flute.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
+#include <vector>
 
 // Use flute LUT file reader.
 #define LUT_FILE 1
@@ -203,7 +206,10 @@ static void readLUTfiles(LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 static void readLUT();
 static void makeLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln);
 static void deleteLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln);
-static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln);
+static void initLUT(int from_d,
+                    int to_d,
+                    LUT_TYPE LUT,
+                    NUMSOLN_TYPE numsoln);
 static void ensureLUT(int d);
 static std::string base64_decode(std::string const& encoded_string);
 #if LUT_SOURCE == LUT_VAR_CHECK
@@ -215,7 +221,10 @@ static void checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+// Highest degree with a valid LUT. It is only raised after the LUT entries
+// are written, so threads that read it can use the LUT without locking.
+static std::atomic<int> lut_valid_d{0};
+static std::mutex lut_mutex;
 
 extern std::string post9;
 extern std::string powv9;
@@ -230,7 +239,7 @@ static void readLUT()
 
 #elif LUT_SOURCE == LUT_VAR
   // Only init to d=8 on startup because d=9 is big and slow.
-  initLUT(lut_initial_d, LUT, numsoln);
+  initLUT(0, lut_initial_d, LUT, numsoln);
 
 #elif LUT_SOURCE == LUT_VAR_CHECK
   readLUTfiles(LUT, numsoln);
@@ -238,7 +247,7 @@ static void readLUT()
   LUT_TYPE LUT_;
   NUMSOLN_TYPE numsoln_;
   makeLUT(LUT_, numsoln_);
-  initLUT(FLUTE_D, LUT_, numsoln_);
+  initLUT(0, FLUTE_D, LUT_, numsoln_);
   checkLUT(LUT, numsoln, LUT_, numsoln_);
 #endif
 }
@@ -282,8 +291,15 @@ static unsigned char charNum(unsigned char c)
 }
 
 // Init LUTs from base64 encoded string variables.
-static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
+// Init the LUTs of degrees from_d+1 to to_d. The entries of lower degrees are
+// parsed but left untouched because other threads may be reading them.
+static void initLUT(int from_d,
+                    int to_d,
+                    LUT_TYPE LUT,
+                    NUMSOLN_TYPE numsoln)
 {
+  std::vector<struct csoln> skipped_soln;
+
   std::string pwv_string = base64_decode(powv9);
   const char* pwv = pwv_string.c_str();
 
@@ -306,13 +322,21 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
         int kk;
         sscanf(pwv, "%d%n", &kk, &char_cnt);
         pwv += char_cnt + 1;
-        numsoln[d][k] = numsoln[d][kk];
-        LUT[d][k] = LUT[d][kk];
+        if (d > from_d) {
+          numsoln[d][k] = numsoln[d][kk];
+          LUT[d][k] = LUT[d][kk];
+        }
       } else {
         pwv++;  // '\n'
-        numsoln[d][k] = ns;
-        struct csoln* p = new struct csoln[ns];
-        LUT[d][k] = p;
+        struct csoln* p;
+        if (d > from_d) {
+          numsoln[d][k] = ns;
+          p = new struct csoln[ns];
+          LUT[d][k] = p;
+        } else {
+          skipped_soln.resize(ns);
+          p = skipped_soln.data();
+        }
         for (int i = 1; i <= ns; i++) {
           p->parent = charNum(*pwv++);
 
@@ -358,11 +382,16 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 
 static void ensureLUT(int d)
 {
+  const int valid_d = lut_valid_d;
+  if (valid_d > 0 && (d <= valid_d || d > FLUTE_D)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex);
   if (LUT == nullptr) {
     readLUT();
   }
   if (d > lut_valid_d && d <= FLUTE_D) {
-    initLUT(FLUTE_D, LUT, numsoln);
+    initLUT(lut_valid_d, FLUTE_D, LUT, numsoln);
   }
 }
 